@@ -57,6 +57,7 @@ print_header() {
     echo "  Total simulations: $TOTAL_SIMS"
     echo "  Expected runtime: ~45 minutes"
     echo "  Output: $OUTPUT_DIR"
+    echo "  Live summary: ./build/aggregate-results --input-dir=$OUTPUT_DIR --watch=true --expect=$TOTAL_SIMS"
     echo "=============================================================="
     echo ""
 }
@@ -150,6 +151,13 @@ print_summary() {
     echo "Total runtime: $(format_time $total_time)"
     echo ""
 
+    # Streaming summary (per-protocol CIs, ANOVA, Cohen's d, bootstrap/permutation checks)
+    if [ -x ./build/aggregate-results ]; then
+        ./build/aggregate-results --input-dir="$OUTPUT_DIR" \
+            --bootstrap=10000 --permutations=10000 || true
+        echo ""
+    fi
+
     if [ $FAILED -eq 0 ]; then
         echo -e "${GREEN}${BOLD}✓ ALL SIMULATIONS PASSED${NC}"
         echo ""
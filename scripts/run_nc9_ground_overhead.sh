@@ -59,6 +59,7 @@ print_header() {
     echo "Total simulations: ${TOTAL_SIMS} (${#PROTOCOLS[@]} protocols × ${#SEEDS[@]} seeds)"
     echo "Estimated time: ~40 minutes (full) or ~2 min (test mode)"
     echo "Output directory: ${OUTPUT_DIR}"
+    echo "Live summary: ./build/aggregate-results --input-dir=${OUTPUT_DIR} --watch=true --expect=${TOTAL_SIMS}"
     echo "=================================================="
     echo ""
 }
@@ -178,6 +179,13 @@ print_summary() {
     done
     echo ""
 
+    # Streaming summary (per-protocol CIs, ANOVA, Cohen's d, bootstrap/permutation checks)
+    if [ -x ./build/aggregate-results ]; then
+        ./build/aggregate-results --input-dir="${OUTPUT_DIR}" \
+            --bootstrap=10000 --permutations=10000 || true
+        echo ""
+    fi
+
     if [ $FAILED -eq 0 ]; then
         echo -e "${GREEN}✓ All simulations completed successfully${NC}"
     else
@@ -0,0 +1,216 @@
+/**
+ * Phase 7: Streaming Result Aggregation Tool
+ *
+ * Aggregates unified-simulation CSVs into per-(protocol, mobility, node count)
+ * summary tables with one-way ANOVA, η², Cohen's d and 95% CIs. Optionally adds
+ * bootstrap CIs and permutation tests (ResamplingEngine) as non-parametric checks.
+ *
+ * Each CSV is parsed exactly once and folded into Welford accumulators, so the
+ * report cost does not grow with the number of runs already seen. In watch mode
+ * the directory is rescanned periodically and the table is reprinted whenever new
+ * results arrive (live view of a running sweep).
+ *
+ * Usage:
+ *   # One-shot summary (replaces the statistics step of analysis/analyze_nc9_invariance.py)
+ *   ./build/aggregate-results --input-dir=results/nc9_overhead_invariance/ground_only
+ *
+ *   # Live summary while a sweep is running (exits once 45 runs are in)
+ *   ./build/aggregate-results --input-dir=results/nc9_overhead_invariance/ground_only \
+ *                             --watch=true --expect=45 --summary-csv=results/live_summary.csv
+ *
+ *   # Add 10^5-resample bootstrap CIs and permutation p-values (all cores)
+ *   ./build/aggregate-results --input-dir=results/nc9_overhead_invariance/ground_only \
+ *                             --bootstrap=100000 --permutations=100000
+ */
+
+#include "ns3/core-module.h"
+#include "result-aggregator.h"
+#include "resampling-engine.h"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <thread>
+
+using namespace ns3;
+
+namespace {
+
+std::vector<std::string> SplitList(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+/**
+ * Fold every not-yet-seen CSV in the directory into the aggregator.
+ *
+ * unified-simulation writes results to a temporary file and renames it into
+ * place, so every *.csv seen here is complete. Files that fail to parse are not
+ * marked as seen and are retried on the next scan.
+ *
+ * @return Number of newly added runs
+ */
+uint32_t ScanDirectory(const std::filesystem::path& dir,
+                       std::set<std::string>& seen,
+                       ResultAggregator& aggregator) {
+    std::vector<std::string> pending;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        if (!entry.is_regular_file() || entry.path().extension() != ".csv") continue;
+        std::string path = entry.path().string();
+        if (!seen.count(path)) pending.push_back(path);
+    }
+    std::sort(pending.begin(), pending.end()); // Deterministic order
+
+    uint32_t added = 0;
+    for (const std::string& path : pending) {
+        RunResult run;
+        if (!ParseResultCsv(path, run)) continue;
+        aggregator.Add(run);
+        seen.insert(path);
+        added++;
+    }
+    return added;
+}
+
+/**
+ * Print bootstrap CIs per cell and a permutation test per stratum.
+ */
+void PrintResampling(const ResultAggregator& aggregator,
+                     const ResamplingEngine& engine,
+                     uint32_t bootstrap,
+                     uint32_t permutations,
+                     double confidence) {
+    std::vector<ResultCellKey> cells = aggregator.GetCells();
+    std::set<std::pair<std::string, uint32_t>> strata;
+    for (const ResultCellKey& key : cells) {
+        strata.insert({key.mobility, key.nodeCount});
+    }
+
+    // Stream ids derived from the cell name, so a cell's draws do not change as
+    // other cells appear in watch mode
+    auto start = std::chrono::steady_clock::now();
+    std::cout << "=== Resampling (" << bootstrap << " bootstrap, " << permutations
+              << " permutations, " << engine.GetThreads() << " threads) ===\n";
+
+    for (const auto& [mobility, nodeCount] : strata) {
+        std::cout << "\n--- mobility=" << mobility << ", nodes=" << nodeCount << " ---\n";
+
+        for (const std::string& metric : aggregator.GetMetrics()) {
+            std::cout << "\n  " << metric << ":\n";
+            const std::string stratumId = mobility + "/" + std::to_string(nodeCount) + "/" + metric;
+            std::vector<std::vector<double>> groups;
+            for (const ResultCellKey& key : cells) {
+                if (key.mobility != mobility || key.nodeCount != nodeCount) continue;
+                const std::vector<double>& samples = aggregator.GetSamples(key, metric);
+                if (samples.empty()) continue;
+                groups.push_back(samples);
+
+                if (bootstrap > 0) {
+                    BootstrapResult b = engine.BootstrapMean(
+                        samples, bootstrap, confidence, ResamplingEngine::StreamId(stratumId + "/" + key.protocol));
+                    std::cout << "    " << std::left << std::setw(10) << key.protocol << std::right
+                              << std::fixed << std::setprecision(4)
+                              << " boot CI [" << b.ciLower << ", " << b.ciUpper << "]"
+                              << "  se=" << b.stdError << "\n";
+                }
+            }
+
+            if (permutations > 0 && groups.size() >= 2) {
+                PermutationResult p = engine.PermutationTest(groups, permutations, ResamplingEngine::StreamId(stratumId));
+                std::cout << "    Permutation test (" << p.groups << " groups): p="
+                          << std::setprecision(6) << p.pValue
+                          << (p.pValue < 0.05 ? " (significant)" : "") << "\n";
+            }
+        }
+    }
+
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "\nResampling time: " << std::setprecision(2) << elapsed << " s\n";
+    std::cout.unsetf(std::ios_base::floatfield);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string inputDir = "results/nc9_overhead_invariance/ground_only";
+    std::string metrics = "pdr,avg_delay_ms,nrl";
+    std::string summaryCsv = "";
+    double confidence = 0.95;
+    bool watch = false;
+    double interval = 5.0;
+    uint32_t expect = 0;
+    uint32_t bootstrap = 0;
+    uint32_t permutations = 0;
+    uint32_t threads = 0;
+    uint64_t resampleSeed = 12345;
+
+    CommandLine cmd;
+    cmd.AddValue("input-dir", "Directory with per-run CSV files", inputDir);
+    cmd.AddValue("metrics", "Comma-separated metrics to aggregate", metrics);
+    cmd.AddValue("summary-csv", "Write per-cell summary CSV to this path", summaryCsv);
+    cmd.AddValue("confidence", "Confidence level for CIs", confidence);
+    cmd.AddValue("watch", "Keep rescanning the directory and reprint on new results", watch);
+    cmd.AddValue("interval", "Rescan interval in watch mode (wall-clock seconds)", interval);
+    cmd.AddValue("expect", "Exit watch mode once this many runs are aggregated (0 = never)", expect);
+    cmd.AddValue("bootstrap", "Bootstrap resamples per cell for percentile CIs (0 = off)", bootstrap);
+    cmd.AddValue("permutations", "Permutations per stratum for the equal-means test (0 = off)", permutations);
+    cmd.AddValue("threads", "Resampling worker threads (0 = all cores)", threads);
+    cmd.AddValue("resample-seed", "Base seed of the resampling RNG streams", resampleSeed);
+    cmd.Parse(argc, argv);
+
+    if (!std::filesystem::is_directory(inputDir)) {
+        std::cerr << "ERROR: Input directory not found: " << inputDir << "\n";
+        return 1;
+    }
+
+    ResultAggregator aggregator(SplitList(metrics));
+    aggregator.SetConfidence(confidence);
+    aggregator.SetRetainSamples(bootstrap > 0 || permutations > 0);
+    ResamplingEngine engine(resampleSeed, threads);
+    std::set<std::string> seen;
+
+    auto report = [&]() {
+        aggregator.PrintSummary(std::cout);
+        std::cout << std::endl;
+        if (bootstrap > 0 || permutations > 0) {
+            PrintResampling(aggregator, engine, bootstrap, permutations, confidence);
+            std::cout << std::endl;
+        }
+        if (!summaryCsv.empty() && !aggregator.WriteSummaryCsv(summaryCsv)) {
+            std::cerr << "WARNING: Could not write " << summaryCsv << "\n";
+        }
+    };
+
+    uint32_t added = ScanDirectory(inputDir, seen, aggregator);
+    if (!watch) {
+        if (aggregator.GetRunCount() == 0) {
+            std::cerr << "ERROR: No result CSVs found in " << inputDir << "\n";
+            return 1;
+        }
+        report();
+        return 0;
+    }
+
+    // Watch mode: report whenever new runs arrive
+    if (added > 0) report();
+    while (expect == 0 || aggregator.GetRunCount() < expect) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(interval));
+        added = ScanDirectory(inputDir, seen, aggregator);
+        if (added > 0) {
+            std::cout << "[+" << added << " runs, total " << aggregator.GetRunCount();
+            if (expect > 0) std::cout << "/" << expect;
+            std::cout << "]\n";
+            report();
+        }
+    }
+    return 0;
+}
@@ -51,4 +51,11 @@ std::string AodvRoutingProtocol::GetConfig() const {
     return oss.str();
 }
 
+int64_t AodvRoutingProtocol::AssignStreams(NodeContainer nodes, int64_t stream) {
+    InternetStackHelper internet;
+    int64_t used = internet.AssignStreams(nodes, stream);
+    used += m_aodvHelper.AssignStreams(nodes, stream + used);
+    return used;
+}
+
 } // namespace ns3
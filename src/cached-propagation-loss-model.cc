@@ -0,0 +1,113 @@
+/**
+ * Cached Propagation Loss Model Implementation
+ */
+
+#include "cached-propagation-loss-model.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/simulator.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("CachedPropagationLossModel");
+NS_OBJECT_ENSURE_REGISTERED(CachedPropagationLossModel);
+
+TypeId CachedPropagationLossModel::GetTypeId() {
+    static TypeId tid = TypeId("ns3::CachedPropagationLossModel")
+        .SetParent<PropagationLossModel>()
+        .SetGroupName("Propagation")
+        .AddConstructor<CachedPropagationLossModel>()
+        .AddAttribute("Model", "Wrapped loss model (head of a chain)",
+                      PointerValue(),
+                      MakePointerAccessor(&CachedPropagationLossModel::m_model),
+                      MakePointerChecker<PropagationLossModel>())
+        .AddAttribute("DistanceThreshold", "Recompute once either endpoint has moved this far (m)",
+                      DoubleValue(1.0),
+                      MakeDoubleAccessor(&CachedPropagationLossModel::m_threshold),
+                      MakeDoubleChecker<double>(0.0))
+        .AddAttribute("Enabled", "Cache losses (false = pass every call to the wrapped model)",
+                      BooleanValue(true),
+                      MakeBooleanAccessor(&CachedPropagationLossModel::m_enabled),
+                      MakeBooleanChecker());
+    return tid;
+}
+
+CachedPropagationLossModel::CachedPropagationLossModel()
+    : m_threshold(1.0),
+      m_enabled(true),
+      m_hits(0),
+      m_misses(0) {
+}
+
+void CachedPropagationLossModel::DoDispose() {
+    m_model = nullptr;
+    m_cache.clear();
+    m_epochs.clear();
+    PropagationLossModel::DoDispose();
+}
+
+double CachedPropagationLossModel::DoCalcRxPower(double txPowerDbm, Ptr<MobilityModel> a,
+                                                 Ptr<MobilityModel> b) const {
+    NS_ASSERT_MSG(m_model, "CachedPropagationLossModel needs a wrapped Model");
+    if (!m_enabled) {
+        return m_model->CalcRxPower(txPowerDbm, a, b);
+    }
+
+    if (PeekPointer(b) < PeekPointer(a)) {
+        std::swap(a, b);
+    }
+    const uint32_t epochA = GetEpoch(a);
+    const uint32_t epochB = GetEpoch(b);
+    const Time now = Simulator::Now();
+
+    auto key = std::make_pair(PeekPointer(a), PeekPointer(b));
+    auto it = m_cache.find(key);
+    if (it != m_cache.end() && it->second.epochA == epochA && it->second.epochB == epochB &&
+        now < it->second.expiry) {
+        m_hits++;
+        return txPowerDbm - it->second.lossDb;
+    }
+
+    m_misses++;
+    double rxPowerDbm = m_model->CalcRxPower(txPowerDbm, a, b);
+    Time validity = std::min(GetValidity(a), GetValidity(b));
+    Time expiry = validity >= Time::Max() - now ? Time::Max() : now + validity;
+    m_cache[key] = Entry{txPowerDbm - rxPowerDbm, epochA, epochB, expiry};
+    return rxPowerDbm;
+}
+
+Time CachedPropagationLossModel::GetValidity(Ptr<MobilityModel> mobility) const {
+    const Vector velocity = mobility->GetVelocity();
+    const double speed = std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y + velocity.z * velocity.z);
+    const double seconds = speed > 0.0 ? m_threshold / speed : 0.0;
+    if (speed <= 0.0 || seconds >= Time::Max().GetSeconds()) {
+        return Time::Max();
+    }
+    return Seconds(seconds);
+}
+
+uint32_t CachedPropagationLossModel::GetEpoch(Ptr<MobilityModel> mobility) const {
+    auto it = m_epochs.find(PeekPointer(mobility));
+    if (it != m_epochs.end()) {
+        return it->second;
+    }
+    mobility->TraceConnectWithoutContext(
+        "CourseChange",
+        MakeCallback(&CachedPropagationLossModel::CourseChanged, const_cast<CachedPropagationLossModel*>(this)));
+    m_epochs[PeekPointer(mobility)] = 0;
+    return 0;
+}
+
+void CachedPropagationLossModel::CourseChanged(Ptr<const MobilityModel> mobility) {
+    m_epochs[PeekPointer(mobility)]++;
+}
+
+int64_t CachedPropagationLossModel::DoAssignStreams(int64_t stream) {
+    return m_model ? m_model->AssignStreams(stream) : 0;
+}
+
+} // namespace ns3
@@ -0,0 +1,107 @@
+/**
+ * Cached Propagation Loss Model
+ *
+ * Purpose: Realistic ground propagation at close to the cost of the range model
+ * Features:
+ * - Wraps a loss model chain ("Model", e.g. log-distance + shadowing) and memoises
+ *   the loss in dB per node pair
+ * - A cached value is reused while neither endpoint has reported a course change
+ *   (mobility CourseChange trace) and, for moving endpoints, until the faster one
+ *   can have covered DistanceThreshold at its speed when the loss was computed;
+ *   a hit reads no positions (stationary pairs never expire)
+ * - Speeds are taken to be constant between course changes, as in the waypoint,
+ *   Manhattan and constant-velocity models
+ * - Pairs are unordered: the loss is computed once for a → b and reused for b → a
+ *   (links stay reciprocal, also for random shadowing)
+ * - Random components are drawn once per pair and position epoch, i.e. shadowing
+ *   that changes when nodes move rather than per frame
+ * - Enabled=false passes every call through (same chain, no caching). With a random
+ *   component in the chain this is a different channel model, not the same one
+ *   uncached: every frame and direction draws afresh (fast fading-like, asymmetric
+ *   links) instead of a fixed reciprocal value per epoch. Compare cached and uncached
+ *   runs only for deterministic chains
+ *
+ * Do not chain further models behind this one with SetNext(); put them in the
+ * wrapped chain so their loss is cached too.
+ *
+ * Usage:
+ *   Ptr<LogDistancePropagationLossModel> logDistance = CreateObject<...>();
+ *   logDistance->SetNext(CreateObject<RandomPropagationLossModel>());
+ *   Ptr<CachedPropagationLossModel> cached = CreateObject<CachedPropagationLossModel>();
+ *   cached->SetAttribute("Model", PointerValue(logDistance));
+ *   cached->SetAttribute("DistanceThreshold", DoubleValue(1.0));
+ *   yansChannel->SetPropagationLossModel(cached);
+ */
+
+#ifndef CACHED_PROPAGATION_LOSS_MODEL_H
+#define CACHED_PROPAGATION_LOSS_MODEL_H
+
+#include "ns3/propagation-loss-model.h"
+#include "ns3/mobility-model.h"
+#include "ns3/nstime.h"
+#include <unordered_map>
+#include <utility>
+
+namespace ns3 {
+
+class CachedPropagationLossModel : public PropagationLossModel {
+public:
+    static TypeId GetTypeId();
+
+    CachedPropagationLossModel();
+    ~CachedPropagationLossModel() override = default;
+
+    /**
+     * Calls answered from the cache / computed by the wrapped model
+     */
+    uint64_t GetHits() const { return m_hits; }
+    uint64_t GetMisses() const { return m_misses; }
+
+    /**
+     * Node pairs currently cached
+     */
+    size_t GetCachedPairs() const { return m_cache.size(); }
+
+private:
+    struct Entry {
+        double lossDb;
+        uint32_t epochA;
+        uint32_t epochB;
+        Time expiry;  // Time::Max() if both endpoints are stationary
+    };
+
+    struct PairHash {
+        size_t operator()(const std::pair<const MobilityModel*, const MobilityModel*>& key) const {
+            return std::hash<const void*>()(key.first) * 31 + std::hash<const void*>()(key.second);
+        }
+    };
+
+    double DoCalcRxPower(double txPowerDbm, Ptr<MobilityModel> a, Ptr<MobilityModel> b) const override;
+    int64_t DoAssignStreams(int64_t stream) override;
+    void DoDispose() override;
+
+    /**
+     * Course change epoch of a mobility model (hooks its CourseChange trace when first seen)
+     */
+    uint32_t GetEpoch(Ptr<MobilityModel> mobility) const;
+    void CourseChanged(Ptr<const MobilityModel> mobility);
+
+    /**
+     * Time until a node can have moved DistanceThreshold (Time::Max() if stationary)
+     */
+    Time GetValidity(Ptr<MobilityModel> mobility) const;
+
+    // Attributes
+    Ptr<PropagationLossModel> m_model;
+    double m_threshold;
+    bool m_enabled;
+
+    mutable std::unordered_map<std::pair<const MobilityModel*, const MobilityModel*>, Entry, PairHash> m_cache;
+    mutable std::unordered_map<const MobilityModel*, uint32_t> m_epochs;
+    mutable uint64_t m_hits;
+    mutable uint64_t m_misses;
+};
+
+} // namespace ns3
+
+#endif // CACHED_PROPAGATION_LOSS_MODEL_H
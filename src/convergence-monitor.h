@@ -0,0 +1,113 @@
+/**
+ * Convergence Monitor
+ *
+ * Purpose: Detect routing convergence instead of assuming a fixed warm-up
+ * Features:
+ * - Periodically probes each (source node, destination address) pair through the
+ *   source's Ipv4RoutingProtocol::RouteOutput (no packets are sent)
+ * - A pair is routed when RouteOutput returns a non-loopback route
+ *   (AODV answers an unknown destination with a deferred loopback route)
+ * - Converged once every pair is routed and no next hop (gateway, device) has
+ *   changed for a hold-down period; a timeout caps the wait
+ * - Convergence time = start of the stable period; the callback fires when the
+ *   hold-down expires (or at the timeout)
+ *
+ * Pairs of reactive protocols should not be added: they need no warm-up.
+ * With no pairs the monitor converges at Start().
+ *
+ * Usage:
+ *   ConvergenceMonitor convergence(Seconds(0.5), Seconds(2.0), Seconds(20.0));
+ *   convergence.AddPair(satNodes.Get(0), sat23Addr);
+ *   convergence.SetConvergedCallback([&](Time now) { ... start traffic ... });
+ *   convergence.Start();
+ */
+
+#ifndef CONVERGENCE_MONITOR_H
+#define CONVERGENCE_MONITOR_H
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ipv4-address.h"
+#include <functional>
+#include <vector>
+
+namespace ns3 {
+
+class ConvergenceMonitor {
+public:
+    /**
+     * @param checkInterval Time between probes
+     * @param holdDown Time routes must stay complete and unchanged
+     * @param timeout Give up waiting at this simulation time (callback still fires)
+     */
+    ConvergenceMonitor(Time checkInterval, Time holdDown, Time timeout);
+
+    void AddPair(Ptr<Node> source, Ipv4Address destination);
+
+    /**
+     * Called once, with the current time, when converged or timed out
+     */
+    void SetConvergedCallback(std::function<void(Time)> callback) { m_converged = std::move(callback); }
+
+    /**
+     * Schedule the first probe now (before Simulator::Run: at t = 0)
+     */
+    void Start();
+
+    /**
+     * @return true if routes converged before the timeout
+     */
+    bool HasConverged() const { return m_done && !m_timedOut; }
+
+    /**
+     * Start of the stable period (valid once finished; the timeout if timed out)
+     */
+    Time GetConvergenceTime() const { return m_convergenceTime; }
+
+    /**
+     * Time the callback fired (convergence + hold-down, or timeout)
+     */
+    Time GetDecisionTime() const { return m_decisionTime; }
+
+    uint32_t GetNumPairs() const { return m_pairs.size(); }
+    uint32_t GetProbes() const { return m_probes; }
+
+private:
+    struct Pair {
+        Ptr<Node> source;
+        Ipv4Address destination;
+        Ipv4Address gateway;   // Last probed next hop
+        uint32_t device;       // Last probed output device index (UINT32_MAX = none)
+    };
+
+    /**
+     * Probe all pairs, update the stable period and finish or reschedule.
+     */
+    void Check();
+
+    /**
+     * Probe one pair; updates its last next hop.
+     * @return true if routed and the next hop is unchanged since the last probe
+     */
+    bool Probe(Pair& pair, bool& routed);
+
+    void Finish(bool timedOut);
+
+    std::vector<Pair> m_pairs;
+    Time m_checkInterval;
+    Time m_holdDown;
+    Time m_timeout;
+    Time m_stableSince;
+    bool m_stable;
+    bool m_done;
+    bool m_timedOut;
+    Time m_convergenceTime;
+    Time m_decisionTime;
+    uint32_t m_probes;
+    std::function<void(Time)> m_converged;
+    EventId m_checkEvent;
+};
+
+} // namespace ns3
+
+#endif // CONVERGENCE_MONITOR_H
@@ -60,4 +60,19 @@ std::string DsdvRoutingProtocol::GetConfig() const {
     return oss.str();
 }
 
+int64_t DsdvRoutingProtocol::AssignStreams(NodeContainer nodes, int64_t stream) {
+    InternetStackHelper internet;
+    int64_t used = internet.AssignStreams(nodes, stream);
+
+    // DsdvHelper has no AssignStreams: DSDV is the node's top-level routing protocol
+    for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+        Ptr<Ipv4> ipv4 = nodes.Get(i)->GetObject<Ipv4>();
+        Ptr<dsdv::RoutingProtocol> dsdv = ipv4 ? DynamicCast<dsdv::RoutingProtocol>(ipv4->GetRoutingProtocol()) : nullptr;
+        if (dsdv) {
+            used += dsdv->AssignStreams(stream + used);
+        }
+    }
+    return used;
+}
+
 } // namespace ns3
@@ -0,0 +1,234 @@
+/**
+ * Geometric ISL Routing Implementation
+ *
+ * Forwarding needs only this satellite's coordinates, its four ports and the
+ * destination satellite ID. Detours are not loop-free in general (there is no
+ * state to remember them); the IP TTL bounds any loop around multiple failures.
+ */
+
+#include "geometric-isl-routing.h"
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/ipv4-list-routing.h"
+#include "ns3/log.h"
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("GeometricIslRouting");
+
+NS_OBJECT_ENSURE_REGISTERED(GeometricIslRouting);
+
+TypeId GeometricIslRouting::GetTypeId() {
+    static TypeId tid = TypeId("ns3::GeometricIslRouting")
+        .SetParent<Ipv4RoutingProtocol>()
+        .SetGroupName("Internet")
+        .AddConstructor<GeometricIslRouting>();
+    return tid;
+}
+
+GeometricIslRouting::GeometricIslRouting()
+    : m_satId(UINT32_MAX),
+      m_numPlanes(0),
+      m_satsPerPlane(0),
+      m_forwarded(0),
+      m_detours(0) {
+}
+
+void GeometricIslRouting::DoDispose() {
+    m_ipv4 = nullptr;
+    m_addressToSat.reset();
+    Ipv4RoutingProtocol::DoDispose();
+}
+
+void GeometricIslRouting::Configure(uint32_t satId, uint32_t numPlanes, uint32_t satsPerPlane,
+                                    std::array<IslPort, NUM_PORTS> ports,
+                                    std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> addressToSat) {
+    m_satId = satId;
+    m_numPlanes = numPlanes;
+    m_satsPerPlane = satsPerPlane;
+    m_ports = ports;
+    m_addressToSat = std::move(addressToSat);
+}
+
+uint32_t GeometricIslRouting::RankPorts(uint32_t src, uint32_t dst, uint32_t numPlanes, uint32_t satsPerPlane,
+                                        std::array<Port, NUM_PORTS>& ranked) {
+    // Offsets along each ring (0 .. n−1 going "up": forward / next plane)
+    const uint32_t planeOffset = (dst / satsPerPlane + numPlanes - src / satsPerPlane) % numPlanes;
+    const uint32_t indexOffset = (dst % satsPerPlane + satsPerPlane - src % satsPerPlane) % satsPerPlane;
+    const uint32_t planeHops = std::min(planeOffset, numPlanes - planeOffset);
+    const uint32_t indexHops = std::min(indexOffset, satsPerPlane - indexOffset);
+
+    uint32_t n = 0;
+    bool used[NUM_PORTS] = {false, false, false, false};
+    auto add = [&](Port port) {
+        if (!used[port]) {
+            used[port] = true;
+            ranked[n++] = port;
+        }
+    };
+    auto addRing = [&](uint32_t offset, uint32_t size, Port up, Port down) {
+        if (offset == 0) return;
+        if (2 * offset <= size) add(up);
+        if (2 * offset >= size) add(down);
+    };
+
+    if (indexHops >= planeHops) {
+        addRing(indexOffset, satsPerPlane, FORWARD, BACKWARD);
+        addRing(planeOffset, numPlanes, NEXT_PLANE, PREV_PLANE);
+    } else {
+        addRing(planeOffset, numPlanes, NEXT_PLANE, PREV_PLANE);
+        addRing(indexOffset, satsPerPlane, FORWARD, BACKWARD);
+    }
+    const uint32_t productive = n;
+    for (Port port : {FORWARD, BACKWARD, NEXT_PLANE, PREV_PLANE}) {
+        add(port);
+    }
+    return productive;
+}
+
+uint32_t GeometricIslRouting::ChoosePort(const std::array<Port, NUM_PORTS>& ranked, uint8_t upPorts, uint32_t arrival) {
+    // Going back out of the arrival port, even when it is productive, undoes the
+    // previous hop's detour and loops; it is the last resort
+    for (uint32_t k = 0; k < NUM_PORTS; ++k) {
+        if ((upPorts & (1u << ranked[k])) && ranked[k] != arrival) return k;
+    }
+    for (uint32_t k = 0; k < NUM_PORTS; ++k) {
+        if ((upPorts & (1u << ranked[k])) && ranked[k] == arrival) return k;
+    }
+    return NUM_PORTS;
+}
+
+Ptr<Ipv4Route> GeometricIslRouting::Lookup(const Ipv4Header& header, uint32_t inInterface) const {
+    if (!m_addressToSat) return nullptr;
+
+    auto it = m_addressToSat->find(header.GetDestination().Get());
+    if (it == m_addressToSat->end() || it->second == m_satId) return nullptr;
+
+    std::array<Port, NUM_PORTS> ranked;
+    const uint32_t productive = RankPorts(m_satId, it->second, m_numPlanes, m_satsPerPlane, ranked);
+
+    uint8_t upPorts = 0;
+    uint32_t arrival = NUM_PORTS;
+    for (uint32_t p = 0; p < NUM_PORTS; ++p) {
+        if (m_ipv4->IsUp(m_ports[p].interface)) upPorts |= static_cast<uint8_t>(1u << p);
+        if (m_ports[p].interface == inInterface) arrival = p;
+    }
+
+    const uint32_t chosen = ChoosePort(ranked, upPorts, arrival);
+    if (chosen == NUM_PORTS) return nullptr;
+    if (chosen >= productive) {
+        m_detours++;
+    }
+
+    const IslPort& out = m_ports[ranked[chosen]];
+    Ptr<Ipv4Route> route = Create<Ipv4Route>();
+    route->SetDestination(header.GetDestination());
+    route->SetGateway(out.gateway);
+    route->SetOutputDevice(m_ipv4->GetNetDevice(out.interface));
+    route->SetSource(m_ipv4->GetAddress(out.interface, 0).GetLocal());
+    return route;
+}
+
+Ptr<Ipv4Route> GeometricIslRouting::RouteOutput(Ptr<Packet> p,
+                                                const Ipv4Header& header,
+                                                Ptr<NetDevice> oif,
+                                                Socket::SocketErrno& sockerr) {
+    NS_LOG_FUNCTION(this << header.GetDestination());
+
+    Ptr<Ipv4Route> route;
+    if (!oif) {
+        route = Lookup(header, UINT32_MAX);
+    }
+    sockerr = route ? Socket::ERROR_NOTERROR : Socket::ERROR_NOROUTETOHOST;
+    return route;
+}
+
+bool GeometricIslRouting::RouteInput(Ptr<const Packet> p,
+                                     const Ipv4Header& header,
+                                     Ptr<const NetDevice> idev,
+                                     const UnicastForwardCallback& ucb,
+                                     const MulticastForwardCallback& mcb,
+                                     const LocalDeliverCallback& lcb,
+                                     const ErrorCallback& ecb) {
+    NS_LOG_FUNCTION(this << header.GetDestination());
+
+    // Local delivery and multicast are handled by Ipv4ListRouting / Ipv4StaticRouting
+    if (header.GetDestination().IsMulticast() || header.GetDestination().IsBroadcast()) {
+        return false;
+    }
+
+    int32_t inInterface = m_ipv4->GetInterfaceForDevice(idev);
+    Ptr<Ipv4Route> route = Lookup(header, inInterface < 0 ? UINT32_MAX : static_cast<uint32_t>(inInterface));
+    if (!route) return false;
+
+    m_forwarded++;
+    ucb(route, p, header);
+    return true;
+}
+
+void GeometricIslRouting::PrintRoutingTable(Ptr<OutputStreamWrapper> stream, Time::Unit unit) const {
+    std::ostream* os = stream->GetStream();
+    *os << "GeometricIslRouting: Sat " << m_satId << " (plane " << m_satId / m_satsPerPlane
+        << ", index " << m_satId % m_satsPerPlane << " of " << m_numPlanes << "×" << m_satsPerPlane
+        << "), " << m_forwarded << " packets forwarded, " << m_detours << " detours\n";
+}
+
+// ============================================================================
+// GeometricIslRoutingHelper
+// ============================================================================
+
+GeometricIslRoutingHelper::GeometricIslRoutingHelper(uint32_t numPlanes, uint32_t satsPerPlane)
+    : m_numPlanes(numPlanes),
+      m_satsPerPlane(satsPerPlane) {
+}
+
+void GeometricIslRoutingHelper::Install(NodeContainer satellites, const IslTopology& topology,
+                                        const IslNetworkCreator& creator) {
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(satellites.GetN() == m_numPlanes * m_satsPerPlane,
+        satellites.GetN() << " satellites do not form a " << m_numPlanes << "×" << m_satsPerPlane << " grid");
+
+    auto addressToSat = creator.GetAddressToSatellite();
+
+    m_protocols.clear();
+    for (uint32_t sat = 0; sat < satellites.GetN(); ++sat) {
+        const std::vector<uint32_t>& neighbors = topology.neighbors.at(sat);
+        NS_ASSERT_MSG(neighbors.size() == GeometricIslRouting::NUM_PORTS,
+            "Sat " << sat << " has " << neighbors.size() << " ISL neighbors (+Grid needs 4)");
+
+        std::vector<IslPort> portList = creator.GetIslPorts(sat, neighbors);
+        std::array<IslPort, GeometricIslRouting::NUM_PORTS> ports;
+        std::copy(portList.begin(), portList.end(), ports.begin());
+
+        Ptr<Ipv4ListRouting> list = DynamicCast<Ipv4ListRouting>(satellites.Get(sat)->GetObject<Ipv4>()->GetRoutingProtocol());
+        NS_ASSERT_MSG(list, "Sat " << sat << " has no Ipv4ListRouting");
+
+        Ptr<GeometricIslRouting> routing = CreateObject<GeometricIslRouting>();
+        routing->Configure(sat, m_numPlanes, m_satsPerPlane, ports, addressToSat);
+        list->AddRoutingProtocol(routing, 10); // Above Ipv4StaticRouting (0)
+        m_protocols.push_back(routing);
+    }
+
+    NS_LOG_INFO("Installed GeometricIslRouting on " << m_protocols.size() << " satellites ("
+        << m_numPlanes << " planes × " << m_satsPerPlane << ")");
+}
+
+uint64_t GeometricIslRoutingHelper::GetForwardedPackets() const {
+    uint64_t total = 0;
+    for (Ptr<GeometricIslRouting> routing : m_protocols) {
+        total += routing->GetForwardedPackets();
+    }
+    return total;
+}
+
+uint64_t GeometricIslRoutingHelper::GetDetours() const {
+    uint64_t total = 0;
+    for (Ptr<GeometricIslRouting> routing : m_protocols) {
+        total += routing->GetDetours();
+    }
+    return total;
+}
+
+} // namespace ns3
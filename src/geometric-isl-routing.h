@@ -0,0 +1,154 @@
+/**
+ * Geometric ISL Routing
+ *
+ * Purpose: Stateless +Grid forwarding from satellite coordinates
+ * Features:
+ * - Next hop from (plane, index) of this satellite and the destination, in the
+ *   numbering of GenerateWalkerDeltaTopology (ID = plane × S + index); no tables,
+ *   no control traffic, O(1) state per satellite
+ * - Both rings wrap (index S−1 ↔ 0 in a plane, plane P−1 ↔ 0 across the seam);
+ *   each dimension goes the shorter way round
+ * - The dimension with more hops left goes first (intra-plane on ties), so a
+ *   detour around a failed link does not bounce straight back
+ * - Failed links (interface down): the other productive port, then a detour port;
+ *   never back out of the arrival interface (productive or not) unless nothing else
+ *   is up, so a detour is not undone by the next hop's shortest-path choice
+ * - Added to each satellite's Ipv4ListRouting above Ipv4StaticRouting, which
+ *   handles local delivery and connected /30 networks
+ *
+ * Usage:
+ *   creator.RecordIslLinks(satellites, islInterfaces);
+ *   GeometricIslRoutingHelper helper(numPlanes, satsPerPlane);
+ *   helper.Install(satellites, topology, creator);
+ */
+
+#ifndef GEOMETRIC_ISL_ROUTING_H
+#define GEOMETRIC_ISL_ROUTING_H
+
+#include "ns3/ipv4-routing-protocol.h"
+#include "ns3/ipv4.h"
+#include "ns3/node-container.h"
+#include "isl-topology-generator.h"
+#include "isl-network-creator.h"
+#include "isl-table-routing.h"
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+class GeometricIslRouting : public Ipv4RoutingProtocol {
+public:
+    /**
+     * Ports in GenerateWalkerDeltaTopology neighbor order
+     */
+    enum Port { FORWARD = 0, BACKWARD = 1, NEXT_PLANE = 2, PREV_PLANE = 3, NUM_PORTS = 4 };
+
+    static TypeId GetTypeId();
+
+    GeometricIslRouting();
+    ~GeometricIslRouting() override = default;
+
+    /**
+     * @param satId This satellite's ID
+     * @param numPlanes Orbital planes (P)
+     * @param satsPerPlane Satellites per plane (S)
+     * @param ports ISL ports in neighbor list order (FORWARD, BACKWARD, NEXT_PLANE, PREV_PLANE)
+     * @param addressToSat Any satellite address (host order) → satellite ID
+     */
+    void Configure(uint32_t satId, uint32_t numPlanes, uint32_t satsPerPlane,
+                   std::array<IslPort, NUM_PORTS> ports,
+                   std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> addressToSat);
+
+    /**
+     * All ports of src ranked towards dst: productive ports first (dimension with
+     * more hops left first, both directions when a ring is split evenly), then detours
+     *
+     * @return Number of productive ports at the front (0 if src == dst)
+     */
+    static uint32_t RankPorts(uint32_t src, uint32_t dst, uint32_t numPlanes, uint32_t satsPerPlane,
+                              std::array<Port, NUM_PORTS>& ranked);
+
+    /**
+     * First ranked port that is up and is not the arrival port; the arrival port
+     * only if no other port is up
+     *
+     * @param upPorts Bit p set if port p's interface is up
+     * @param arrival Port the packet arrived on, NUM_PORTS at the origin
+     * @return Position in ranked, or NUM_PORTS if no port is up
+     */
+    static uint32_t ChoosePort(const std::array<Port, NUM_PORTS>& ranked, uint8_t upPorts, uint32_t arrival);
+
+    uint64_t GetForwardedPackets() const { return m_forwarded; }
+    uint64_t GetDetours() const { return m_detours; }
+
+    // Ipv4RoutingProtocol
+    Ptr<Ipv4Route> RouteOutput(Ptr<Packet> p,
+                               const Ipv4Header& header,
+                               Ptr<NetDevice> oif,
+                               Socket::SocketErrno& sockerr) override;
+    bool RouteInput(Ptr<const Packet> p,
+                    const Ipv4Header& header,
+                    Ptr<const NetDevice> idev,
+                    const UnicastForwardCallback& ucb,
+                    const MulticastForwardCallback& mcb,
+                    const LocalDeliverCallback& lcb,
+                    const ErrorCallback& ecb) override;
+    void NotifyInterfaceUp(uint32_t interface) override {}
+    void NotifyInterfaceDown(uint32_t interface) override {}
+    void NotifyAddAddress(uint32_t interface, Ipv4InterfaceAddress address) override {}
+    void NotifyRemoveAddress(uint32_t interface, Ipv4InterfaceAddress address) override {}
+    void SetIpv4(Ptr<Ipv4> ipv4) override { m_ipv4 = ipv4; }
+    void PrintRoutingTable(Ptr<OutputStreamWrapper> stream, Time::Unit unit = Time::S) const override;
+
+protected:
+    void DoDispose() override;
+
+private:
+    /**
+     * Route towards header's destination, or nullptr (not a satellite, this
+     * satellite, or no port up)
+     *
+     * @param inInterface Arrival interface (avoided for detours), UINT32_MAX at the origin
+     */
+    Ptr<Ipv4Route> Lookup(const Ipv4Header& header, uint32_t inInterface) const;
+
+    Ptr<Ipv4> m_ipv4;
+    uint32_t m_satId;
+    uint32_t m_numPlanes;
+    uint32_t m_satsPerPlane;
+    std::array<IslPort, NUM_PORTS> m_ports;
+    std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> m_addressToSat;
+    mutable uint64_t m_forwarded;
+    mutable uint64_t m_detours;
+};
+
+/**
+ * Installs GeometricIslRouting on all satellites
+ */
+class GeometricIslRoutingHelper {
+public:
+    GeometricIslRoutingHelper(uint32_t numPlanes, uint32_t satsPerPlane);
+
+    /**
+     * Add GeometricIslRouting (priority 10) to every satellite's Ipv4ListRouting
+     *
+     * @param satellites Satellite nodes (node ID = satellite ID)
+     * @param topology ISL topology from GenerateWalkerDeltaTopology (port order)
+     * @param creator Network creator after RecordIslLinks / InstallStaticRoutes
+     */
+    void Install(NodeContainer satellites, const IslTopology& topology, const IslNetworkCreator& creator);
+
+    uint64_t GetForwardedPackets() const;
+    uint64_t GetDetours() const;
+
+private:
+    uint32_t m_numPlanes;
+    uint32_t m_satsPerPlane;
+    std::vector<Ptr<GeometricIslRouting>> m_protocols;
+};
+
+} // namespace ns3
+
+#endif // GEOMETRIC_ISL_ROUTING_H
@@ -0,0 +1,55 @@
+/**
+ * Geometric Routing Protocol
+ *
+ * Implements RoutingProtocol interface for stateless +Grid ISL forwarding
+ * (GeometricIslRouting). The next hop follows from satellite IDs in the
+ * Walker-Delta numbering, so there are no tables and no control packets.
+ *
+ * Key characteristics:
+ * - Category: "static"
+ * - Control bytes: 0 (no control packets)
+ * - Convergence: Instant (nothing to learn)
+ * - Failures: Local detour around links whose interface is down
+ *
+ * Parameters: planes, sats_per_plane (grid shape; GeometricIslRoutingHelper is
+ * installed once the ISL links exist)
+ */
+
+#ifndef GEOMETRIC_ROUTING_PROTOCOL_H
+#define GEOMETRIC_ROUTING_PROTOCOL_H
+
+#include "routing-protocol.h"
+
+namespace ns3 {
+
+/**
+ * Geometric ISL routing protocol wrapper.
+ *
+ * Install() only creates the internet stack (Ipv4ListRouting with static routing
+ * for local delivery); the geometric forwarder is added per satellite after the
+ * ISL links are addressed.
+ */
+class GeometricRoutingProtocol : public RoutingProtocol {
+public:
+    GeometricRoutingProtocol();
+    ~GeometricRoutingProtocol() override = default;
+
+    void Install(NodeContainer islNodes, NodeContainer groundNodes) override;
+    std::string GetName() const override { return "Geometric"; }
+    std::string GetCategory() const override { return "static"; }
+    uint64_t GetControlBytes() const override { return 0; } // No control packets
+    void SetParameter(std::string key, std::string value) override;
+    std::string GetConfig() const override;
+    int64_t AssignStreams(NodeContainer nodes, int64_t stream) override;
+
+    uint32_t GetNumPlanes() const { return m_numPlanes; }
+    uint32_t GetSatsPerPlane() const { return m_satsPerPlane; }
+
+private:
+    uint32_t m_numPlanes;
+    uint32_t m_satsPerPlane;
+};
+
+} // namespace ns3
+
+#endif // GEOMETRIC_ROUTING_PROTOCOL_H
@@ -0,0 +1,147 @@
+/**
+ * Ground QoS Helper Implementation
+ *
+ * The select-queue callback replaces the one WifiHelper installs by default
+ * (user priority from the IP DS field, which is 0 for all simulated traffic), so
+ * without Configure() every frame stays in AC_BE as before.
+ */
+
+#include "ground-qos-helper.h"
+#include "routing-control-classifier.h"
+#include "ns3/ipv4-queue-disc-item.h"
+#include "ns3/socket.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("GroundQosHelper");
+
+namespace {
+/**
+ * User priority for each AC (index = AcIndex): BE 0, BK 1, VI 5, VO 6
+ */
+const uint8_t AC_USER_PRIORITY[GroundQosHelper::NUM_ACS] = {0, 1, 5, 6};
+
+std::size_t SelectQueueByTrafficClass(uint8_t controlPriority, uint8_t dataPriority, Ptr<QueueItem> item) {
+    uint8_t priority = dataPriority;
+    Ptr<Ipv4QueueDiscItem> ipItem = DynamicCast<Ipv4QueueDiscItem>(item);
+    if (ipItem && RoutingControlClassifier::IsRoutingControl(ipItem->GetHeader(), ipItem->GetPacket())) {
+        priority = controlPriority;
+    }
+    SocketPriorityTag priorityTag;
+    priorityTag.SetPriority(priority);
+    item->GetPacket()->ReplacePacketTag(priorityTag);
+    return static_cast<std::size_t>(QosUtilsMapTidToAc(priority));
+}
+}
+
+bool GroundQosHelper::ParseAc(const std::string& name, AcIndex& ac) {
+    if (name == "vo") {
+        ac = AC_VO;
+    } else if (name == "vi") {
+        ac = AC_VI;
+    } else if (name == "be") {
+        ac = AC_BE;
+    } else if (name == "bk") {
+        ac = AC_BK;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::string GroundQosHelper::GetAcName(AcIndex ac) {
+    switch (ac) {
+        case AC_VO: return "vo";
+        case AC_VI: return "vi";
+        case AC_BE: return "be";
+        case AC_BK: return "bk";
+        default: return "undef";
+    }
+}
+
+GroundQosHelper::GroundQosHelper(AcIndex controlAc, AcIndex dataAc)
+    : m_controlAc(controlAc),
+      m_dataAc(dataAc) {
+    NS_ASSERT_MSG(controlAc < NUM_ACS && dataAc < NUM_ACS, "Invalid access category");
+    m_queueDrops.fill(0);
+    m_transmissions.fill(0);
+    m_retries.fill(0);
+    m_retryDrops.fill(0);
+}
+
+void GroundQosHelper::Configure(WifiHelper& wifi, WifiMacHelper& mac) const {
+    // QoS alone would also turn on A-MPDU (BE/BK/VI default 65535 bytes on HT), so
+    // aggregation stays off and the non-QoS run remains a control for prioritisation only
+    mac.SetType("ns3::AdhocWifiMac",
+                "QosSupported", BooleanValue(true),
+                "BE_MaxAmpduSize", UintegerValue(0),
+                "BK_MaxAmpduSize", UintegerValue(0),
+                "VI_MaxAmpduSize", UintegerValue(0),
+                "VO_MaxAmpduSize", UintegerValue(0));
+    wifi.SetSelectQueueCallback(MakeBoundCallback(&SelectQueueByTrafficClass,
+                                                  AC_USER_PRIORITY[m_controlAc],
+                                                  AC_USER_PRIORITY[m_dataAc]));
+}
+
+void GroundQosHelper::Install(NetDeviceContainer devices) {
+    for (uint32_t i = 0; i < devices.GetN(); ++i) {
+        Ptr<WifiNetDevice> device = DynamicCast<WifiNetDevice>(devices.Get(i));
+        if (!device || !device->GetMac()->GetQosSupported()) {
+            NS_LOG_WARN("Device " << i << " is not a QoS WiFi device, no statistics");
+            continue;
+        }
+        Ptr<WifiMac> mac = device->GetMac();
+        std::array<Ptr<WifiMacQueue>, NUM_ACS> queues;
+        for (uint32_t ac = 0; ac < NUM_ACS; ++ac) {
+            queues[ac] = mac->GetQosTxop(static_cast<AcIndex>(ac))->GetWifiMacQueue();
+        }
+        m_queues.push_back(queues);
+        mac->TraceConnectWithoutContext("DroppedMpdu", MakeCallback(&GroundQosHelper::MpduDropped, this));
+        device->GetPhy()->TraceConnectWithoutContext("PhyTxPsduBegin",
+                                                     MakeCallback(&GroundQosHelper::PsduTxBegin, this));
+    }
+    NS_LOG_INFO("QoS statistics on " << m_queues.size() << " ground devices (control → AC_"
+                << GetAcName(m_controlAc) << ", data → AC_" << GetAcName(m_dataAc) << ")");
+}
+
+uint64_t GroundQosHelper::GetEnqueued(AcIndex ac) const {
+    uint64_t enqueued = 0;
+    for (const auto& queues : m_queues) {
+        enqueued += queues[ac]->GetTotalReceivedPackets();
+    }
+    return enqueued;
+}
+
+bool GroundQosHelper::GetFrameAc(const WifiMacHeader& header, AcIndex& ac) {
+    if (!header.IsQosData()) {
+        return false;
+    }
+    ac = QosUtilsMapTidToAc(header.GetQosTid());
+    return true;
+}
+
+void GroundQosHelper::PsduTxBegin(WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW) {
+    for (const auto& [staId, psdu] : psduMap) {
+        for (const Ptr<WifiMpdu>& mpdu : *psdu) {
+            AcIndex ac;
+            if (!GetFrameAc(mpdu->GetHeader(), ac)) continue;
+            m_transmissions[ac]++;
+            if (mpdu->GetHeader().IsRetry()) {
+                m_retries[ac]++;
+            }
+        }
+    }
+}
+
+void GroundQosHelper::MpduDropped(WifiMacDropReason reason, Ptr<const WifiMpdu> mpdu) {
+    AcIndex ac;
+    if (!GetFrameAc(mpdu->GetHeader(), ac)) return;
+    if (reason == WIFI_MAC_DROP_REACHED_RETRY_LIMIT) {
+        m_retryDrops[ac]++;
+    } else {
+        m_queueDrops[ac]++;
+    }
+}
+
+} // namespace ns3
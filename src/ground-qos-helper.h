@@ -0,0 +1,116 @@
+/**
+ * Ground QoS Helper
+ *
+ * Purpose: EDCA access categories for ground WiFi traffic classes
+ * Features:
+ * - QoS-enabled ad-hoc MAC: one EDCA queue per access category (AC_BE, AC_BK,
+ *   AC_VI, AC_VO) with its own contention parameters
+ * - A-MPDU aggregation stays off in every AC (as without QoS), so QoS runs differ
+ *   from their control runs in channel access only
+ * - Routing protocol messages (RoutingControlClassifier: OLSR 698, AODV 654,
+ *   DSDV 269 over UDP) are mapped to the control AC (default AC_VO), everything
+ *   else to the data AC (default AC_BE); both configurable
+ * - Mapping is done in the device's select-queue callback, which sets the user
+ *   priority the MAC uses to pick the EDCA queue (and the matching traffic
+ *   control queue above it)
+ * - Per-AC statistics over all devices: MPDUs enqueued, queue drops, transmissions,
+ *   retransmissions, drops at the retry limit
+ *
+ * Usage:
+ *   GroundQosHelper qos(AC_VO, AC_BE);
+ *   qos.Configure(wifi, mac);                 // Before the devices are installed
+ *   NetDeviceContainer devices = ...Install(wifi, phy, mac, ...);
+ *   qos.Install(devices);                     // Statistics
+ *   ...
+ *   qos.GetRetries(AC_VO);
+ */
+
+#ifndef GROUND_QOS_HELPER_H
+#define GROUND_QOS_HELPER_H
+
+#include "ns3/net-device-container.h"
+#include "ns3/wifi-module.h"
+#include <array>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+class GroundQosHelper {
+public:
+    static const uint32_t NUM_ACS = 4;
+
+    /**
+     * Parse "vo" | "vi" | "be" | "bk"
+     *
+     * @return false for an unknown name
+     */
+    static bool ParseAc(const std::string& name, AcIndex& ac);
+
+    /**
+     * Short name of an access category ("vo", "vi", "be", "bk")
+     */
+    static std::string GetAcName(AcIndex ac);
+
+    /**
+     * @param controlAc Access category for routing protocol messages
+     * @param dataAc Access category for all other packets
+     */
+    GroundQosHelper(AcIndex controlAc, AcIndex dataAc);
+
+    /**
+     * Enable QoS on the MAC and install the traffic class mapping on the WiFi helper
+     * (must be called before devices are installed with these helpers)
+     */
+    void Configure(WifiHelper& wifi, WifiMacHelper& mac) const;
+
+    /**
+     * Collect per-AC statistics from the devices (WifiNetDevices with a QoS MAC)
+     */
+    void Install(NetDeviceContainer devices);
+
+    AcIndex GetControlAc() const { return m_controlAc; }
+    AcIndex GetDataAc() const { return m_dataAc; }
+
+    /**
+     * MPDUs enqueued in the EDCA queue of an AC (all devices)
+     */
+    uint64_t GetEnqueued(AcIndex ac) const;
+
+    /**
+     * MPDUs dropped before transmission: queue full or lifetime expired
+     */
+    uint64_t GetQueueDrops(AcIndex ac) const { return m_queueDrops[ac]; }
+
+    /**
+     * MPDU transmissions (first attempts and retries) and retransmissions only
+     */
+    uint64_t GetTransmissions(AcIndex ac) const { return m_transmissions[ac]; }
+    uint64_t GetRetries(AcIndex ac) const { return m_retries[ac]; }
+
+    /**
+     * MPDUs dropped after the retry limit
+     */
+    uint64_t GetRetryDrops(AcIndex ac) const { return m_retryDrops[ac]; }
+
+private:
+    void PsduTxBegin(WifiConstPsduMap psduMap, WifiTxVector txVector, double txPowerW);
+    void MpduDropped(WifiMacDropReason reason, Ptr<const WifiMpdu> mpdu);
+
+    /**
+     * AC of a QoS data frame (false for management, control and non-QoS frames)
+     */
+    static bool GetFrameAc(const WifiMacHeader& header, AcIndex& ac);
+
+    AcIndex m_controlAc;
+    AcIndex m_dataAc;
+    std::vector<std::array<Ptr<WifiMacQueue>, NUM_ACS>> m_queues;  // [device][ac]
+    std::array<uint64_t, NUM_ACS> m_queueDrops;
+    std::array<uint64_t, NUM_ACS> m_transmissions;
+    std::array<uint64_t, NUM_ACS> m_retries;
+    std::array<uint64_t, NUM_ACS> m_retryDrops;
+};
+
+} // namespace ns3
+
+#endif // GROUND_QOS_HELPER_H
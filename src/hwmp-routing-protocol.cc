@@ -0,0 +1,92 @@
+/**
+ * Phase 4 Week 22: HWMP Routing Protocol Implementation
+ */
+
+#include "hwmp-routing-protocol.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/mesh-point-device.h"
+#include <sstream>
+
+namespace ns3 {
+
+HwmpRoutingProtocol::HwmpRoutingProtocol()
+    : m_activePathTimeout(5.0),
+      m_maxPreqRetries(3),
+      m_preqMinInterval(0.1) {
+    // Constructor - initialize with NS-3 HWMP defaults
+    m_meshHelper.SetStackInstaller("ns3::Dot11sStack");
+}
+
+NetDeviceContainer HwmpRoutingProtocol::InstallDevices(const WifiPhyHelper& phy, NodeContainer nodes) {
+    // HWMP parameters are protocol attributes, read when the mesh stack is created
+    Config::SetDefault("ns3::dot11s::HwmpProtocol::Dot11MeshHWMPactivePathTimeout",
+                       TimeValue(Seconds(m_activePathTimeout)));
+    Config::SetDefault("ns3::dot11s::HwmpProtocol::Dot11MeshHWMPmaxPREQretries",
+                       UintegerValue(m_maxPreqRetries));
+    Config::SetDefault("ns3::dot11s::HwmpProtocol::Dot11MeshHWMPpreqMinInterval",
+                       TimeValue(Seconds(m_preqMinInterval)));
+
+    // 802.11s mesh interfaces are non-HT: 802.11a at the highest rate, 6 Mbps for control
+    m_meshHelper.SetStandard(WIFI_STANDARD_80211a);
+    m_meshHelper.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                         "DataMode", StringValue("OfdmRate54Mbps"),
+                                         "ControlMode", StringValue("OfdmRate6Mbps"));
+    m_meshHelper.SetMacType("RandomStart", TimeValue(Seconds(0.1)));
+    m_meshHelper.SetNumberOfInterfaces(1);
+
+    NetDeviceContainer devices = m_meshHelper.Install(phy, nodes);
+    m_frames.Install(devices);
+    return devices;
+}
+
+void HwmpRoutingProtocol::Install(NodeContainer islNodes, NodeContainer groundNodes) {
+    // Path selection happens below IP: ground nodes only need the internet stack
+    // (ISL nodes are not supported - HWMP needs 802.11s mesh devices)
+    if (groundNodes.GetN() > 0) {
+        InternetStackHelper internet;
+        internet.Install(groundNodes);
+    }
+}
+
+uint64_t HwmpRoutingProtocol::GetControlBytes() const {
+    return m_frames.GetControlBytesTx();
+}
+
+void HwmpRoutingProtocol::SetParameter(std::string key, std::string value) {
+    if (key == "active_path_timeout") {
+        m_activePathTimeout = std::stod(value);
+    } else if (key == "max_preq_retries") {
+        m_maxPreqRetries = std::stoi(value);
+    } else if (key == "preq_min_interval") {
+        m_preqMinInterval = std::stod(value);
+    }
+    // Ignore unknown parameters (consistent with other protocols)
+}
+
+std::string HwmpRoutingProtocol::GetConfig() const {
+    std::ostringstream oss;
+    oss << "HWMP[active_path_timeout=" << m_activePathTimeout
+        << ",max_preq_retries=" << m_maxPreqRetries
+        << ",preq_min_interval=" << m_preqMinInterval << "]";
+    return oss.str();
+}
+
+int64_t HwmpRoutingProtocol::AssignStreams(NodeContainer nodes, int64_t stream) {
+    InternetStackHelper internet;
+    int64_t used = internet.AssignStreams(nodes, stream);
+
+    // MeshHelper assigns per device (interface MACs, HWMP and peering jitter)
+    NetDeviceContainer meshDevices;
+    for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+        for (uint32_t d = 0; d < nodes.Get(i)->GetNDevices(); ++d) {
+            Ptr<MeshPointDevice> mp = DynamicCast<MeshPointDevice>(nodes.Get(i)->GetDevice(d));
+            if (mp) {
+                meshDevices.Add(mp);
+            }
+        }
+    }
+    used += m_meshHelper.AssignStreams(meshDevices, stream + used);
+    return used;
+}
+
+} // namespace ns3
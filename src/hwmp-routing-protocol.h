@@ -0,0 +1,83 @@
+/**
+ * Phase 4 Week 22: HWMP Routing Protocol
+ *
+ * Implements RoutingProtocol interface for HWMP (IEEE 802.11s Hybrid Wireless Mesh Protocol).
+ * Wraps NS-3 MeshHelper (Dot11sStack) with unified interface.
+ *
+ * Unlike the IP-layer protocols, HWMP selects paths at layer 2: the mesh forms one
+ * broadcast domain and IP sees every node as a direct neighbour. The wrapper therefore
+ * creates the ground devices itself (InstallDevices, instead of plain ad-hoc WiFi) and
+ * Install() only adds the internet stack.
+ *
+ * Key characteristics:
+ * - Category: "hybrid" (on-demand PREQ/PREP discovery, optional proactive root tree)
+ * - Control overhead: PREQ/PREP/PERR action frames, beacons and peering frames,
+ *   counted by a MeshFrameTracer on the devices (GetControlBytes)
+ * - Convergence: Peering (beacons + peer link open/confirm), then on-demand paths
+ * - Failures: PERR and path rediscovery
+ *
+ * Usage:
+ *   auto hwmp = std::make_unique<HwmpRoutingProtocol>();
+ *   NetDeviceContainer devices = hwmp->InstallDevices(phy, groundNodes);
+ *   hwmp->Install(NodeContainer(), groundNodes);
+ *   ... assign addresses to devices ...
+ */
+
+#ifndef HWMP_ROUTING_PROTOCOL_H
+#define HWMP_ROUTING_PROTOCOL_H
+
+#include "routing-protocol.h"
+#include "mesh-frame-tracer.h"
+#include "ns3/mesh-module.h"
+#include "ns3/wifi-module.h"
+
+namespace ns3 {
+
+/**
+ * HWMP routing protocol implementation.
+ *
+ * Wraps NS-3 MeshHelper with unified interface (ground only).
+ */
+class HwmpRoutingProtocol : public RoutingProtocol {
+public:
+    HwmpRoutingProtocol();
+    ~HwmpRoutingProtocol() override = default;
+
+    /**
+     * Create one 802.11s mesh point device per node (802.11a interface on the
+     * PHY helper's channel) and start counting its frames.
+     *
+     * Must be called before Install().
+     *
+     * @param phy PHY helper with the channel set
+     * @param nodes Ground nodes
+     * @return Mesh point devices (one per node, in node order; IP goes on these)
+     */
+    NetDeviceContainer InstallDevices(const WifiPhyHelper& phy, NodeContainer nodes);
+
+    void Install(NodeContainer islNodes, NodeContainer groundNodes) override;
+    std::string GetName() const override { return "HWMP"; }
+    std::string GetCategory() const override { return "hybrid"; }
+    uint64_t GetControlBytes() const override;
+    void SetParameter(std::string key, std::string value) override;
+    std::string GetConfig() const override;
+    int64_t AssignStreams(NodeContainer nodes, int64_t stream) override;
+
+    /**
+     * Layer-2 frame counts of the mesh devices
+     */
+    const MeshFrameTracer& GetFrameTracer() const { return m_frames; }
+
+private:
+    MeshHelper m_meshHelper;
+    MeshFrameTracer m_frames;
+
+    // Protocol parameters (configurable)
+    double m_activePathTimeout;  // seconds
+    uint32_t m_maxPreqRetries;
+    double m_preqMinInterval;    // seconds
+};
+
+} // namespace ns3
+
+#endif // HWMP_ROUTING_PROTOCOL_H
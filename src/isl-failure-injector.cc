@@ -0,0 +1,220 @@
+/**
+ * ISL Failure Injector Implementation
+ *
+ * A failed link keeps its devices attached; only the Ipv4 interfaces are set down,
+ * so queued packets are dropped and Ipv4StaticRouting discards routes through them.
+ * Routes of the satellites whose shortest-path trees changed are then reinstalled.
+ */
+
+#include "isl-failure-injector.h"
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("IslFailureInjector");
+
+IslFailureInjector::IslFailureInjector()
+    : m_creator(nullptr),
+      m_routes(nullptr),
+      m_appliedEvents(0),
+      m_routeUpdates(0) {
+}
+
+bool IslFailureInjector::LoadSchedule(const std::string& path) {
+    NS_LOG_FUNCTION(this << path);
+
+    std::ifstream in(path);
+    if (!in) {
+        NS_LOG_WARN("Cannot open ISL failure schedule " << path);
+        return false;
+    }
+
+    std::string line;
+    uint32_t lineNo = 0;
+    while (std::getline(in, line)) {
+        lineNo++;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+        line.erase(std::remove_if(line.begin(), line.end(), ::isspace), line.end());
+        if (line.empty()) continue;
+
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, ',')) {
+            fields.push_back(field);
+        }
+        if (fields.size() != 5) {
+            NS_LOG_WARN(path << ":" << lineNo << ": expected time,type,a,b,state");
+            return false;
+        }
+
+        IslFailureEvent event;
+        try {
+            event.time = std::stod(fields[0]);
+            event.a = std::stoul(fields[2]);
+            event.b = fields[3].empty() ? 0 : std::stoul(fields[3]);
+        } catch (const std::exception&) {
+            NS_LOG_WARN(path << ":" << lineNo << ": malformed number");
+            return false;
+        }
+
+        if (fields[1] == "link") {
+            event.type = IslFailureEvent::LINK;
+        } else if (fields[1] == "sat") {
+            event.type = IslFailureEvent::SATELLITE;
+        } else {
+            NS_LOG_WARN(path << ":" << lineNo << ": unknown type '" << fields[1] << "' (link|sat)");
+            return false;
+        }
+
+        if (fields[4] != "down" && fields[4] != "up") {
+            NS_LOG_WARN(path << ":" << lineNo << ": unknown state '" << fields[4] << "' (down|up)");
+            return false;
+        }
+        event.up = (fields[4] == "up");
+        m_events.push_back(event);
+    }
+
+    NS_LOG_INFO("Loaded " << m_events.size() << " ISL failure events from " << path);
+    return true;
+}
+
+void IslFailureInjector::GenerateRandomSchedule(const IslTopology& topology, double mtbf, double mttr,
+                                                double start, double stop, int64_t stream) {
+    NS_LOG_FUNCTION(this << mtbf << mttr << start << stop);
+
+    NS_ASSERT_MSG(mtbf > 0.0 && mttr > 0.0, "MTBF and MTTR must be positive");
+
+    Ptr<ExponentialRandomVariable> upTime = CreateObject<ExponentialRandomVariable>();
+    upTime->SetAttribute("Mean", DoubleValue(mtbf));
+    Ptr<ExponentialRandomVariable> downTime = CreateObject<ExponentialRandomVariable>();
+    downTime->SetAttribute("Mean", DoubleValue(mttr));
+    if (stream >= 0) {
+        upTime->SetStream(stream);
+        downTime->SetStream(stream + 1);
+    }
+
+    size_t before = m_events.size();
+    for (const auto& [a, b] : topology.links) {
+        double t = start + upTime->GetValue();
+        while (t < stop) {
+            m_events.push_back(IslFailureEvent(t, IslFailureEvent::LINK, a, b, false));
+            t += downTime->GetValue();
+            if (t >= stop) break;
+            m_events.push_back(IslFailureEvent(t, IslFailureEvent::LINK, a, b, true));
+            t += upTime->GetValue();
+        }
+    }
+
+    NS_LOG_INFO("Generated " << (m_events.size() - before) << " random ISL failure events (MTBF="
+        << mtbf << "s, MTTR=" << mttr << "s)");
+}
+
+void IslFailureInjector::Install(const IslTopology& topology,
+                                 const NetDeviceContainer& islDevices,
+                                 IslNetworkCreator* creator,
+                                 IncrementalIslRoutes* routes) {
+    NS_LOG_FUNCTION(this);
+
+    NS_ASSERT_MSG(islDevices.GetN() == topology.links.size() * 2,
+        "ISL device count " << islDevices.GetN() << " does not match " << topology.links.size() << " links");
+
+    m_islDevices = islDevices;
+    m_creator = creator;
+    m_routes = routes;
+    m_links = topology.links;
+    m_linkUp.assign(m_links.size(), true);
+    m_satUp.assign(topology.numSatellites, true);
+    m_satLinks.assign(topology.numSatellites, {});
+    m_linkIndex.clear();
+    for (uint32_t i = 0; i < m_links.size(); ++i) {
+        m_linkIndex[m_links[i]] = i;
+        m_satLinks[m_links[i].first].push_back(i);
+        m_satLinks[m_links[i].second].push_back(i);
+    }
+
+    for (const IslFailureEvent& event : m_events) {
+        Simulator::Schedule(Seconds(event.time), &IslFailureInjector::Apply, this, event);
+    }
+
+    NS_LOG_INFO("Scheduled " << m_events.size() << " ISL failure events on "
+        << m_links.size() << " links");
+}
+
+void IslFailureInjector::SyncLinkDevices(uint32_t link) {
+    const auto& [a, b] = m_links[link];
+    bool up = m_linkUp[link] && m_satUp[a] && m_satUp[b];
+
+    for (uint32_t d = 2 * link; d <= 2 * link + 1; ++d) {
+        Ptr<NetDevice> device = m_islDevices.Get(d);
+        Ptr<Ipv4> ipv4 = device->GetNode()->GetObject<Ipv4>();
+        int32_t interface = ipv4->GetInterfaceForDevice(device);
+        if (interface < 0 || ipv4->IsUp(interface) == up) continue;
+        if (up) {
+            ipv4->SetUp(interface);
+        } else {
+            ipv4->SetDown(interface);
+        }
+    }
+}
+
+void IslFailureInjector::Apply(IslFailureEvent event) {
+    NS_LOG_FUNCTION(this);
+
+    std::vector<uint32_t> changed;
+    if (event.type == IslFailureEvent::LINK) {
+        auto it = m_linkIndex.find({std::min(event.a, event.b), std::max(event.a, event.b)});
+        if (it == m_linkIndex.end()) {
+            NS_LOG_WARN("No ISL between Sat " << event.a << " and Sat " << event.b << ", event ignored");
+            return;
+        }
+        if (m_linkUp[it->second] == event.up) return;
+
+        m_linkUp[it->second] = event.up;
+        SyncLinkDevices(it->second);
+        if (m_routes) {
+            changed = m_routes->SetLinkState(event.a, event.b, event.up);
+        }
+    } else {
+        if (event.a >= m_satUp.size()) {
+            NS_LOG_WARN("No satellite " << event.a << ", event ignored");
+            return;
+        }
+        if (m_satUp[event.a] == event.up) return;
+
+        m_satUp[event.a] = event.up;
+        for (uint32_t link : m_satLinks[event.a]) {
+            SyncLinkDevices(link);
+        }
+        if (m_routes) {
+            changed = m_routes->SetSatelliteState(event.a, event.up);
+        }
+    }
+    m_appliedEvents++;
+
+    // Push repaired routes into the forwarding layer
+    if (m_routes && m_creator) {
+        for (uint32_t src : changed) {
+            m_creator->UpdateStaticRoutes(src, *m_routes);
+        }
+        m_routeUpdates += changed.size();
+    }
+    if (m_routes && m_routesChanged) {
+        m_routesChanged();
+    }
+
+    NS_LOG_INFO(Simulator::Now().GetSeconds() << "s: "
+        << (event.type == IslFailureEvent::LINK ? "ISL " : "Sat ") << event.a
+        << (event.type == IslFailureEvent::LINK ? "↔" + std::to_string(event.b) : std::string())
+        << (event.up ? " up" : " down") << ", " << changed.size() << " satellites rerouted");
+}
+
+} // namespace ns3
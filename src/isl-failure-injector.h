@@ -0,0 +1,130 @@
+/**
+ * ISL Failure Injector
+ *
+ * Purpose: Fail and restore ISL links or whole satellites during a run
+ * Features:
+ * - Schedule from file or random per-link failures (exponential MTBF/MTTR)
+ * - Failures applied to the live PointToPoint devices (Ipv4 interface down/up)
+ * - Static ISL routes repaired incrementally (IncrementalIslRoutes) and pushed into
+ *   the satellites' Ipv4StaticRouting tables; dynamic protocols react on their own
+ *
+ * Schedule file format (CSV, '#' starts a comment):
+ *   # time_s,type,a,b,state
+ *   30.0,link,3,11,down
+ *   42.5,link,3,11,up
+ *   50.0,sat,7,,down
+ *
+ * Usage:
+ *   IslFailureInjector injector;
+ *   injector.LoadSchedule("scenarios/isl_failures.csv");
+ *   injector.GenerateRandomSchedule(topology, 300.0, 30.0, 20.0, simTime);
+ *   injector.Install(topology, islDevices, &creator, &routes); // routes = nullptr for OLSR
+ */
+
+#ifndef ISL_FAILURE_INJECTOR_H
+#define ISL_FAILURE_INJECTOR_H
+
+#include "ns3/net-device-container.h"
+#include "isl-topology-generator.h"
+#include "isl-network-creator.h"
+#include "static-isl-routing.h"
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * One scheduled state change
+ */
+struct IslFailureEvent {
+    enum Type { LINK, SATELLITE };
+
+    double time;  // Simulation time (s)
+    Type type;
+    uint32_t a;   // Link endpoint / satellite ID
+    uint32_t b;   // Other link endpoint (unused for SATELLITE)
+    bool up;      // true = restore, false = fail
+
+    IslFailureEvent() : time(0.0), type(LINK), a(0), b(0), up(false) {}
+    IslFailureEvent(double t, Type ty, uint32_t x, uint32_t y, bool u)
+        : time(t), type(ty), a(x), b(y), up(u) {}
+};
+
+class IslFailureInjector {
+public:
+    IslFailureInjector();
+
+    /**
+     * Append events from a schedule file
+     * @return false if the file cannot be read or a line is malformed
+     */
+    bool LoadSchedule(const std::string& path);
+
+    /**
+     * Append alternating down/up events for every link
+     *
+     * Up times ~ Exp(mtbf), down times ~ Exp(mttr), starting at start and
+     * ending before stop (a link down at stop stays down).
+     *
+     * @param topology ISL topology (links)
+     * @param mtbf Mean time between failures per link (s)
+     * @param mttr Mean time to repair (s)
+     * @param start First possible failure time (s)
+     * @param stop End of the failure window (s)
+     * @param stream First of two RNG streams (up/down times); negative = automatic
+     */
+    void GenerateRandomSchedule(const IslTopology& topology, double mtbf, double mttr,
+                                double start, double stop, int64_t stream = -1);
+
+    void AddEvent(const IslFailureEvent& event) { m_events.push_back(event); }
+
+    /**
+     * Schedule all events on the simulator
+     *
+     * @param topology ISL topology (link i owns islDevices 2i and 2i+1)
+     * @param islDevices ISL devices (from IslNetworkCreator::CreateIslMesh)
+     * @param creator Network creator that installed the static routes
+     * @param routes Incremental routes to repair (nullptr for dynamic ISL routing)
+     */
+    void Install(const IslTopology& topology,
+                 const NetDeviceContainer& islDevices,
+                 IslNetworkCreator* creator,
+                 IncrementalIslRoutes* routes);
+
+    /**
+     * Called after each applied event once static routes are repaired
+     * (e.g. to refresh an IslNextHopTable from the incremental routes)
+     */
+    void SetRoutesChangedCallback(std::function<void()> callback) { m_routesChanged = std::move(callback); }
+
+    uint32_t GetScheduledEvents() const { return m_events.size(); }
+    uint32_t GetAppliedEvents() const { return m_appliedEvents; }
+    uint64_t GetRouteUpdates() const { return m_routeUpdates; } // Satellites whose routes were reinstalled
+
+private:
+    void Apply(IslFailureEvent event);
+
+    /**
+     * Bring both devices of a link up/down to match link and satellite state.
+     */
+    void SyncLinkDevices(uint32_t link);
+
+    std::vector<IslFailureEvent> m_events;
+    std::vector<std::pair<uint32_t, uint32_t>> m_links;
+    std::map<std::pair<uint32_t, uint32_t>, uint32_t> m_linkIndex;  // (a < b) → link index
+    std::vector<std::vector<uint32_t>> m_satLinks;                  // Satellite → incident links
+    std::vector<bool> m_linkUp;
+    std::vector<bool> m_satUp;
+    NetDeviceContainer m_islDevices;
+    IslNetworkCreator* m_creator;
+    IncrementalIslRoutes* m_routes;
+    std::function<void()> m_routesChanged;
+    uint32_t m_appliedEvents;
+    uint64_t m_routeUpdates;
+};
+
+} // namespace ns3
+
+#endif // ISL_FAILURE_INJECTOR_H
@@ -0,0 +1,117 @@
+/**
+ * ISL Link Monitor
+ *
+ * Purpose: Per-link ISL load and queue occupancy over time
+ * Features:
+ * - Per-direction counters (bytes, packets, drops) from PointToPointNetDevice traces
+ * - Drops counted at both the device queue (MacTxDrop) and the root queue disc
+ * - Periodic sampling of queue length (device queue + queue disc) into histograms
+ * - Time series CSV (one row per link direction per sample) and summary CSV
+ *
+ * Indexing: direction index = 2 × link + dir, where link is the index into
+ * IslTopology::links and dir 0 = a→b, dir 1 = b→a (same order as the ISL devices).
+ * All counters live in flat arrays of that index.
+ *
+ * Usage:
+ *   IslLinkMonitor monitor;
+ *   monitor.Install(topology, islDevices, Seconds(1.0), "results/isl_links_timeseries.csv");
+ *   Simulator::Run();
+ *   monitor.WriteSummary("results/isl_links_summary.csv");
+ */
+
+#ifndef ISL_LINK_MONITOR_H
+#define ISL_LINK_MONITOR_H
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "isl-topology-generator.h"
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+class QueueDisc;
+class QueueDiscItem;
+
+class IslLinkMonitor {
+public:
+    /**
+     * @param histogramBins Number of queue-length histogram bins (last bin is open-ended)
+     * @param binWidth Queue-length bin width in packets
+     */
+    IslLinkMonitor(uint32_t histogramBins = 20, uint32_t binWidth = 10);
+    ~IslLinkMonitor();
+
+    /**
+     * Hook all ISL devices and start periodic sampling
+     *
+     * Must be called after AssignIslAddresses (the root queue discs exist from then on).
+     *
+     * @param topology ISL topology (link i owns islDevices 2i and 2i+1)
+     * @param islDevices ISL devices (from IslNetworkCreator::CreateIslMesh)
+     * @param interval Sampling interval
+     * @param timeSeriesPath Time series CSV path (empty = no time series)
+     */
+    void Install(const IslTopology& topology,
+                 const NetDeviceContainer& islDevices,
+                 Time interval,
+                 const std::string& timeSeriesPath);
+
+    /**
+     * Write per-direction totals and queue-length histograms
+     * @return false if the file cannot be written
+     */
+    bool WriteSummary(const std::string& path) const;
+
+    uint32_t GetNumDirections() const { return m_txBytes.size(); }
+    uint64_t GetTotalDrops() const;
+
+    /**
+     * Highest utilisation of any link direction in any sampling interval (0..1)
+     */
+    double GetPeakUtilization() const { return m_peakUtilization; }
+
+    /**
+     * Direction index with the highest mean utilisation, or UINT32_MAX if none
+     */
+    uint32_t GetHotspotDirection() const;
+
+private:
+    static void TxTrace(IslLinkMonitor* monitor, uint32_t dir, Ptr<const Packet> packet);
+    static void DeviceDropTrace(IslLinkMonitor* monitor, uint32_t dir, Ptr<const Packet> packet);
+    static void QueueDiscDropTrace(IslLinkMonitor* monitor, uint32_t dir, Ptr<const QueueDiscItem> item);
+
+    /**
+     * Record queue lengths and per-interval load, then reschedule.
+     */
+    void Sample();
+
+    uint32_t QueueLength(uint32_t dir) const;
+
+    // Per-direction state (index = 2 × link + dir)
+    std::vector<uint64_t> m_txBytes;
+    std::vector<uint64_t> m_txPackets;
+    std::vector<uint64_t> m_drops;
+    std::vector<uint64_t> m_lastTxBytes;     // At previous sample
+    std::vector<uint64_t> m_lastTxPackets;
+    std::vector<uint64_t> m_lastDrops;
+    std::vector<uint32_t> m_maxQueue;
+    std::vector<double> m_dataRateBps;
+    std::vector<uint64_t> m_histogram;       // [dir × bins + bin]
+    std::vector<Ptr<NetDevice>> m_devices;
+    std::vector<Ptr<QueueDisc>> m_queueDiscs;  // Root queue disc per direction (may be null)
+
+    std::vector<std::pair<uint32_t, uint32_t>> m_links;
+    uint32_t m_bins;
+    uint32_t m_binWidth;
+    Time m_interval;
+    uint64_t m_samples;
+    double m_peakUtilization;
+    std::ofstream m_timeSeries;
+    EventId m_sampleEvent;
+};
+
+} // namespace ns3
+
+#endif // ISL_LINK_MONITOR_H
@@ -38,39 +38,33 @@ NetDeviceContainer IslNetworkCreator::CreateIslMesh(NodeContainer satellites, co
     islHelper.SetDeviceAttribute("DataRate", StringValue("10Gbps"));
     islHelper.SetQueue("ns3::DropTailQueue", "MaxSize", StringValue("100p"));
 
-    // Create ISL links
+    // Create ISL links in topology.links order (link i owns devices 2i and 2i+1)
     std::set<std::pair<uint32_t, uint32_t>> createdLinks; // Track created links
 
-    for (uint32_t sat = 0; sat < topology.numSatellites; ++sat) {
-        const auto& neighbors = topology.neighbors.at(sat);
+    for (const auto& linkPair : topology.links) {
+        // Check if link already created
+        if (createdLinks.count(linkPair)) continue;
+        uint32_t sat = linkPair.first;
+        uint32_t neighbor = linkPair.second;
 
-        for (uint32_t neighbor : neighbors) {
-            // Avoid duplicate links (only create sat < neighbor)
-            if (sat >= neighbor) continue;
+        // Compute distance-based delay
+        Ptr<Node> node1 = satellites.Get(sat);
+        Ptr<Node> node2 = satellites.Get(neighbor);
+        double distance = ComputeSatelliteDistance(node1, node2);
+        Time delay = ComputePropagationDelay(distance);
 
-            // Check if link already created
-            std::pair<uint32_t, uint32_t> linkPair = {sat, neighbor};
-            if (createdLinks.count(linkPair)) continue;
+        // Set channel delay
+        islHelper.SetChannelAttribute("Delay", TimeValue(delay));
 
-            // Compute distance-based delay
-            Ptr<Node> node1 = satellites.Get(sat);
-            Ptr<Node> node2 = satellites.Get(neighbor);
-            double distance = ComputeSatelliteDistance(node1, node2);
-            Time delay = ComputePropagationDelay(distance);
+        // Install link
+        NetDeviceContainer linkDevices = islHelper.Install(node1, node2);
+        allIslDevices.Add(linkDevices);
 
-            // Set channel delay
-            islHelper.SetChannelAttribute("Delay", TimeValue(delay));
+        createdLinks.insert(linkPair);
 
-            // Install link
-            NetDeviceContainer linkDevices = islHelper.Install(node1, node2);
-            allIslDevices.Add(linkDevices);
-
-            createdLinks.insert(linkPair);
-
-            NS_LOG_INFO("Created ISL: Sat " << sat << " ↔ Sat " << neighbor
-                << " (distance: " << distance / 1000.0 << " km, delay: "
-                << delay.GetMilliSeconds() << " ms)");
-        }
+        NS_LOG_INFO("Created ISL: Sat " << sat << " ↔ Sat " << neighbor
+            << " (distance: " << distance / 1000.0 << " km, delay: "
+            << delay.GetMilliSeconds() << " ms)");
     }
 
     NS_LOG_INFO("Created " << createdLinks.size() << " ISL links ("
@@ -114,19 +108,16 @@ Ipv4InterfaceContainer IslNetworkCreator::AssignIslAddresses(const NetDeviceCont
     return interfaces;
 }
 
-void IslNetworkCreator::InstallStaticRoutes(NodeContainer satellites,
-                                           const RoutingTables& routes,
-                                           const Ipv4InterfaceContainer& islInterfaces) {
+void IslNetworkCreator::RecordIslLinks(NodeContainer satellites, const Ipv4InterfaceContainer& islInterfaces) {
     NS_LOG_FUNCTION(this);
 
-    Ipv4StaticRoutingHelper staticRoutingHelper;
-    uint32_t totalRoutes = 0;
+    m_satellites = satellites;
+    m_linkToInterface.clear();
+    m_satelliteAddress.clear();
 
     // Step 1: Build mapping from (satA, satB) -> LOCAL interface index on satA
     // Key insight: Each satellite has local interfaces (0=loopback, 1-4=ISL links)
     // We need to map: "Which local interface on satA connects to satB?"
-    std::map<std::pair<uint32_t, uint32_t>, std::pair<uint32_t, Ipv4Address>> linkToLocalInterface;
-
     for (uint32_t i = 0; i < islInterfaces.GetN(); i += 2) {
         // Get the two interfaces connected by this link
         // islInterfaces.Get(i) returns std::pair<Ptr<Ipv4>, uint32_t>
@@ -146,8 +137,8 @@ void IslNetworkCreator::InstallStaticRoutes(NodeContainer satellites,
         Ipv4Address addrB = islInterfaces.GetAddress(i + 1); // IP address on satB's interface
 
         // Store: (satA, satB) -> (local interface on satA, IP address on satA)
-        linkToLocalInterface[{satA, satB}] = {interfaceIdxA, addrA};
-        linkToLocalInterface[{satB, satA}] = {interfaceIdxB, addrB};
+        m_linkToInterface[{satA, satB}] = {interfaceIdxA, addrA};
+        m_linkToInterface[{satB, satA}] = {interfaceIdxB, addrB};
 
         NS_LOG_DEBUG("Link " << i/2 << ": Sat " << satA << " (interface " << interfaceIdxA
                      << ", " << addrA << ") ↔ Sat " << satB << " (interface " << interfaceIdxB
@@ -156,21 +147,28 @@ void IslNetworkCreator::InstallStaticRoutes(NodeContainer satellites,
 
     // Step 2: Build mapping from satellite ID to ANY valid IP address on that satellite
     // This is used as the destination address for routing
-    std::map<uint32_t, Ipv4Address> satelliteAddress;
     for (uint32_t sat = 0; sat < satellites.GetN(); ++sat) {
         Ptr<Ipv4> ipv4 = satellites.Get(sat)->GetObject<Ipv4>();
         // Use the first non-loopback interface's address
         if (ipv4->GetNInterfaces() > 1) {
-            satelliteAddress[sat] = ipv4->GetAddress(1, 0).GetLocal();
+            m_satelliteAddress[sat] = ipv4->GetAddress(1, 0).GetLocal();
         }
     }
+}
+
+void IslNetworkCreator::InstallStaticRoutes(NodeContainer satellites,
+                                           const RoutingTables& routes,
+                                           const Ipv4InterfaceContainer& islInterfaces) {
+    NS_LOG_FUNCTION(this);
+
+    Ipv4StaticRoutingHelper staticRoutingHelper;
+    uint32_t totalRoutes = 0;
+
+    // Steps 1-2: link/interface and satellite address maps
+    RecordIslLinks(satellites, islInterfaces);
 
     // Step 3: Install routes for each satellite
     for (uint32_t src = 0; src < satellites.GetN(); ++src) {
-        Ptr<Node> srcNode = satellites.Get(src);
-        Ptr<Ipv4> srcIpv4 = srcNode->GetObject<Ipv4>();
-        Ptr<Ipv4StaticRouting> staticRouting = staticRoutingHelper.GetStaticRouting(srcIpv4);
-
         // Install routes to all other satellites
         for (uint32_t dst = 0; dst < satellites.GetN(); ++dst) {
             if (src == dst) continue;
@@ -181,39 +179,9 @@ void IslNetworkCreator::InstallStaticRoutes(NodeContainer satellites,
                 continue;
             }
 
-            // Get destination satellite's IP address
-            auto dstAddrIt = satelliteAddress.find(dst);
-            if (dstAddrIt == satelliteAddress.end()) {
-                NS_LOG_WARN("No IP address found for Sat " << dst);
-                continue;
+            if (AddIslRoute(src, dst, nextHop)) {
+                totalRoutes++;
             }
-            Ipv4Address dstAddr = dstAddrIt->second;
-
-            // Find the LOCAL interface on src that connects to nextHop
-            auto linkIt = linkToLocalInterface.find({src, nextHop});
-            if (linkIt == linkToLocalInterface.end()) {
-                NS_LOG_WARN("No interface found for link Sat " << src << " → Sat " << nextHop);
-                continue;
-            }
-
-            uint32_t localInterface = linkIt->second.first;  // Local interface index on src
-
-            // Get the gateway (next-hop IP address)
-            // Gateway is the IP address on the nextHop satellite's side of the link
-            auto gatewayIt = linkToLocalInterface.find({nextHop, src});
-            if (gatewayIt == linkToLocalInterface.end()) {
-                NS_LOG_WARN("No gateway found for reverse link Sat " << nextHop << " → Sat " << src);
-                continue;
-            }
-            Ipv4Address gateway = gatewayIt->second.second;
-
-            // Add route: destination host, gateway, local interface index
-            staticRouting->AddHostRouteTo(dstAddr, gateway, localInterface);
-
-            totalRoutes++;
-
-            NS_LOG_DEBUG("Route: Sat " << src << " → Sat " << dst << " via Sat " << nextHop
-                << " (local_if=" << localInterface << ", gateway=" << gateway << ", dst=" << dstAddr << ")");
         }
     }
 
@@ -237,6 +205,117 @@ void IslNetworkCreator::InstallStaticRoutes(NodeContainer satellites,
     }
 }
 
+bool IslNetworkCreator::AddIslRoute(uint32_t src, uint32_t dst, uint32_t nextHop) {
+    // Get destination satellite's IP address
+    auto dstAddrIt = m_satelliteAddress.find(dst);
+    if (dstAddrIt == m_satelliteAddress.end()) {
+        NS_LOG_WARN("No IP address found for Sat " << dst);
+        return false;
+    }
+    Ipv4Address dstAddr = dstAddrIt->second;
+
+    // Find the LOCAL interface on src that connects to nextHop
+    auto linkIt = m_linkToInterface.find({src, nextHop});
+    if (linkIt == m_linkToInterface.end()) {
+        NS_LOG_WARN("No interface found for link Sat " << src << " → Sat " << nextHop);
+        return false;
+    }
+
+    uint32_t localInterface = linkIt->second.first;  // Local interface index on src
+
+    // Get the gateway (next-hop IP address)
+    // Gateway is the IP address on the nextHop satellite's side of the link
+    auto gatewayIt = m_linkToInterface.find({nextHop, src});
+    if (gatewayIt == m_linkToInterface.end()) {
+        NS_LOG_WARN("No gateway found for reverse link Sat " << nextHop << " → Sat " << src);
+        return false;
+    }
+    Ipv4Address gateway = gatewayIt->second.second;
+
+    // Add route: destination host, gateway, local interface index
+    Ipv4StaticRoutingHelper staticRoutingHelper;
+    Ptr<Ipv4StaticRouting> staticRouting =
+        staticRoutingHelper.GetStaticRouting(m_satellites.Get(src)->GetObject<Ipv4>());
+    staticRouting->AddHostRouteTo(dstAddr, gateway, localInterface);
+
+    NS_LOG_DEBUG("Route: Sat " << src << " → Sat " << dst << " via Sat " << nextHop
+        << " (local_if=" << localInterface << ", gateway=" << gateway << ", dst=" << dstAddr << ")");
+    return true;
+}
+
+uint32_t IslNetworkCreator::UpdateStaticRoutes(uint32_t src, const IncrementalIslRoutes& routes) {
+    NS_LOG_FUNCTION(this << src);
+
+    NS_ASSERT_MSG(src < m_satellites.GetN(), "UpdateStaticRoutes() before InstallStaticRoutes()");
+
+    Ipv4StaticRoutingHelper staticRoutingHelper;
+    Ptr<Ipv4StaticRouting> staticRouting =
+        staticRoutingHelper.GetStaticRouting(m_satellites.Get(src)->GetObject<Ipv4>());
+
+    // Remove existing host routes towards satellites (walk backwards, indices shift)
+    std::set<Ipv4Address> satelliteAddresses;
+    for (const auto& [sat, addr] : m_satelliteAddress) {
+        satelliteAddresses.insert(addr);
+    }
+    for (uint32_t j = staticRouting->GetNRoutes(); j-- > 0;) {
+        Ipv4RoutingTableEntry entry = staticRouting->GetRoute(j);
+        if (entry.IsHost() && satelliteAddresses.count(entry.GetDest())) {
+            staticRouting->RemoveRoute(j);
+        }
+    }
+
+    uint32_t installed = 0;
+    for (uint32_t dst = 0; dst < m_satellites.GetN(); ++dst) {
+        if (src == dst) continue;
+        uint32_t nextHop = routes.GetNextHop(src, dst);
+        if (nextHop == UINT32_MAX) continue; // Partitioned: no route until repair
+        if (AddIslRoute(src, dst, nextHop)) {
+            installed++;
+        }
+    }
+
+    NS_LOG_DEBUG("Updated Sat " << src << ": " << installed << " ISL routes");
+    return installed;
+}
+
+uint32_t IslNetworkCreator::GetLinkInterface(uint32_t sat, uint32_t neighbor) const {
+    auto it = m_linkToInterface.find({sat, neighbor});
+    return (it != m_linkToInterface.end()) ? it->second.first : UINT32_MAX;
+}
+
+Ipv4Address IslNetworkCreator::GetLinkAddress(uint32_t sat, uint32_t neighbor) const {
+    auto it = m_linkToInterface.find({sat, neighbor});
+    return (it != m_linkToInterface.end()) ? it->second.second : Ipv4Address();
+}
+
+std::vector<IslPort> IslNetworkCreator::GetIslPorts(uint32_t sat, const std::vector<uint32_t>& neighbors) const {
+    std::vector<IslPort> ports;
+    ports.reserve(neighbors.size());
+    for (uint32_t neighbor : neighbors) {
+        IslPort port;
+        port.neighbor = neighbor;
+        port.interface = GetLinkInterface(sat, neighbor);
+        port.gateway = GetLinkAddress(neighbor, sat);
+        NS_ASSERT_MSG(port.interface != UINT32_MAX,
+            "No ISL interface for Sat " << sat << " → Sat " << neighbor);
+        ports.push_back(port);
+    }
+    return ports;
+}
+
+std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> IslNetworkCreator::GetAddressToSatellite() const {
+    auto addressToSat = std::make_shared<std::unordered_map<uint32_t, uint32_t>>();
+    for (uint32_t sat = 0; sat < m_satellites.GetN(); ++sat) {
+        Ptr<Ipv4> ipv4 = m_satellites.Get(sat)->GetObject<Ipv4>();
+        for (uint32_t i = 1; i < ipv4->GetNInterfaces(); ++i) {
+            for (uint32_t a = 0; a < ipv4->GetNAddresses(i); ++a) {
+                (*addressToSat)[ipv4->GetAddress(i, a).GetLocal().Get()] = sat;
+            }
+        }
+    }
+    return addressToSat;
+}
+
 double IslNetworkCreator::ComputeSatelliteDistance(Ptr<Node> sat1, Ptr<Node> sat2) {
     NS_LOG_FUNCTION(this);
 
@@ -14,6 +14,9 @@
  *   NetDeviceContainer islDevices = creator.CreateIslMesh(satellites, topology);
  *   Ipv4InterfaceContainer islInterfaces = creator.AssignIslAddresses(islDevices);
  *   creator.InstallStaticRoutes(satellites, routes, islInterfaces);
+ *
+ *   // After a link/satellite failure (see IslFailureInjector)
+ *   creator.UpdateStaticRoutes(src, incrementalRoutes);
  */
 
 #ifndef ISL_NETWORK_CREATOR_H
@@ -25,9 +28,23 @@
 #include "isl-topology-generator.h"
 #include "static-isl-routing.h"
 #include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3 {
 
+/**
+ * One ISL port of a satellite (index = position in topology.neighbors[sat])
+ */
+struct IslPort {
+    uint32_t neighbor;    // Neighbor satellite ID
+    uint32_t interface;   // Local Ipv4 interface index
+    Ipv4Address gateway;  // Neighbor's address on this link
+
+    IslPort() : neighbor(UINT32_MAX), interface(UINT32_MAX) {}
+};
+
 /**
  * Helper class to create ISL network infrastructure
  */
@@ -53,6 +70,16 @@ public:
      */
     Ipv4InterfaceContainer AssignIslAddresses(const NetDeviceContainer& islDevices);
 
+    /**
+     * Record which local interface and address each satellite uses on each ISL
+     * (for GetLinkInterface / GetLinkAddress). InstallStaticRoutes() calls this;
+     * call it directly when no static routes are installed.
+     *
+     * @param satellites Satellite nodes
+     * @param islInterfaces ISL interface container (from AssignIslAddresses)
+     */
+    void RecordIslLinks(NodeContainer satellites, const Ipv4InterfaceContainer& islInterfaces);
+
     /**
      * Install static routes for ISL mesh
      *
@@ -64,6 +91,49 @@ public:
                             const RoutingTables& routes,
                             const Ipv4InterfaceContainer& islInterfaces);
 
+    /**
+     * Replace the installed ISL host routes of one satellite
+     *
+     * Removes src's host routes towards other satellites and re-adds them from the
+     * current next hops (unreachable destinations get no route). Requires a prior
+     * InstallStaticRoutes() call, which records the link/interface mapping.
+     *
+     * @param src Source satellite ID
+     * @param routes Incrementally maintained routes
+     * @return Number of routes installed
+     */
+    uint32_t UpdateStaticRoutes(uint32_t src, const IncrementalIslRoutes& routes);
+
+    /**
+     * Local interface index on sat that connects to neighbor
+     *
+     * @return Interface index, or UINT32_MAX if the satellites share no ISL
+     */
+    uint32_t GetLinkInterface(uint32_t sat, uint32_t neighbor) const;
+
+    /**
+     * Address of sat on its ISL to neighbor (the gateway address neighbor uses towards sat)
+     *
+     * @return Address, or Ipv4Address() if the satellites share no ISL
+     */
+    Ipv4Address GetLinkAddress(uint32_t sat, uint32_t neighbor) const;
+
+    /**
+     * ISL ports of sat in neighbor order (local interface, neighbor's address as
+     * gateway); asserts that every neighbor shares an ISL with sat
+     *
+     * @param sat Satellite ID
+     * @param neighbors Neighbor list (topology.neighbors[sat])
+     */
+    std::vector<IslPort> GetIslPorts(uint32_t sat, const std::vector<uint32_t>& neighbors) const;
+
+    /**
+     * Every address of every satellite (host order, all non-loopback interfaces)
+     * → satellite ID, as the ISL forwarders use it to resolve destinations.
+     * Requires a prior RecordIslLinks() call.
+     */
+    std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> GetAddressToSatellite() const;
+
     /**
      * Compute distance between two satellites (in meters)
      * Uses satellite positions from SatelliteMobilityModel
@@ -85,7 +155,16 @@ public:
     Time ComputePropagationDelay(double distance_m);
 
 private:
-    std::map<std::pair<uint32_t, uint32_t>, uint32_t> m_linkToInterface; // (sat1, sat2) -> interface index
+    /**
+     * Add host route src → dst via nextHop
+     * @return true if the route was installed
+     */
+    bool AddIslRoute(uint32_t src, uint32_t dst, uint32_t nextHop);
+
+    NodeContainer m_satellites;
+    // (satA, satB) -> (local interface on satA, IP address on satA)
+    std::map<std::pair<uint32_t, uint32_t>, std::pair<uint32_t, Ipv4Address>> m_linkToInterface;
+    std::map<uint32_t, Ipv4Address> m_satelliteAddress; // Satellite ID -> routing destination address
 };
 
 } // namespace ns3
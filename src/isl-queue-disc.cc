@@ -0,0 +1,94 @@
+/**
+ * ISL Queue Discipline Implementation
+ */
+
+#include "isl-queue-disc.h"
+#include "routing-control-classifier.h"
+#include "ns3/ipv4-queue-disc-item.h"
+#include "ns3/log.h"
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("IslQueueDisc");
+NS_OBJECT_ENSURE_REGISTERED(IslControlPacketFilter);
+
+TypeId IslControlPacketFilter::GetTypeId() {
+    static TypeId tid = TypeId("ns3::IslControlPacketFilter")
+        .SetParent<Ipv4PacketFilter>()
+        .SetGroupName("TrafficControl")
+        .AddConstructor<IslControlPacketFilter>();
+    return tid;
+}
+
+int32_t IslControlPacketFilter::DoClassify(Ptr<QueueDiscItem> item) const {
+    Ptr<Ipv4QueueDiscItem> ipItem = DynamicCast<Ipv4QueueDiscItem>(item);
+    return RoutingControlClassifier::IsRoutingControl(ipItem->GetHeader(), ipItem->GetPacket())
+               ? IslQueueDiscs::CONTROL
+               : IslQueueDiscs::DATA;
+}
+
+IslQueueDiscs::IslQueueDiscs() {
+    m_sojournCount.fill(0);
+    m_sojournSum.fill(Time(0));
+    m_maxSojourn.fill(Time(0));
+}
+
+void IslQueueDiscs::Install(NetDeviceContainer devices, const std::string& controlLimit) {
+    TrafficControlHelper tch;
+    // Unclassified packets (non-IPv4) go to the data band whatever their priority tag
+    uint16_t handle = tch.SetRootQueueDisc("ns3::PrioQueueDisc",
+                                           "Priomap", StringValue("1 1 1 1 1 1 1 1 1 1 1 1 1 1 1 1"));
+    tch.AddPacketFilter(handle, "ns3::IslControlPacketFilter");
+    TrafficControlHelper::ClassIdList classes = tch.AddQueueDiscClasses(handle, NUM_CLASSES, "ns3::QueueDiscClass");
+    tch.AddChildQueueDisc(handle, classes[CONTROL], "ns3::FifoQueueDisc", "MaxSize", StringValue(controlLimit));
+    tch.AddChildQueueDisc(handle, classes[DATA], "ns3::FqCoDelQueueDisc");
+    tch.SetQueueLimits("ns3::DynamicQueueLimits");
+    QueueDiscContainer roots = tch.Install(devices);
+
+    for (uint32_t i = 0; i < roots.GetN(); ++i) {
+        Ptr<QueueDisc> root = roots.Get(i);
+        for (uint32_t c = 0; c < NUM_CLASSES; ++c) {
+            m_children[c].push_back(root->GetQueueDiscClass(c)->GetQueueDisc());
+        }
+        m_children[CONTROL].back()->TraceConnectWithoutContext(
+            "SojournTime", MakeCallback(&IslQueueDiscs::ControlSojourn, this));
+        m_children[DATA].back()->TraceConnectWithoutContext(
+            "SojournTime", MakeCallback(&IslQueueDiscs::DataSojourn, this));
+    }
+    NS_LOG_INFO("Priority queue discs on " << roots.GetN() << " ISL devices");
+}
+
+uint64_t IslQueueDiscs::GetPackets(Class c) const {
+    uint64_t packets = 0;
+    for (const Ptr<QueueDisc>& qdisc : m_children[c]) {
+        packets += qdisc->GetStats().nTotalReceivedPackets;
+    }
+    return packets;
+}
+
+uint64_t IslQueueDiscs::GetDrops(Class c) const {
+    uint64_t drops = 0;
+    for (const Ptr<QueueDisc>& qdisc : m_children[c]) {
+        drops += qdisc->GetStats().nTotalDroppedPackets;
+    }
+    return drops;
+}
+
+Time IslQueueDiscs::GetMeanSojourn(Class c) const {
+    return m_sojournCount[c] > 0 ? m_sojournSum[c] / static_cast<double>(m_sojournCount[c]) : Time(0);
+}
+
+void IslQueueDiscs::ControlSojourn(Time sojourn) {
+    m_sojournCount[CONTROL]++;
+    m_sojournSum[CONTROL] += sojourn;
+    m_maxSojourn[CONTROL] = std::max(m_maxSojourn[CONTROL], sojourn);
+}
+
+void IslQueueDiscs::DataSojourn(Time sojourn) {
+    m_sojournCount[DATA]++;
+    m_sojournSum[DATA] += sojourn;
+    m_maxSojourn[DATA] = std::max(m_maxSojourn[DATA], sojourn);
+}
+
+} // namespace ns3
@@ -0,0 +1,92 @@
+/**
+ * ISL Queue Discipline
+ *
+ * Purpose: Keep routing control traffic ahead of data on ISL devices
+ * Features:
+ * - Root PrioQueueDisc with two bands: band 0 (control) is always served first,
+ *   band 1 (data) only when band 0 is empty
+ * - IslControlPacketFilter puts routing protocol messages (RoutingControlClassifier:
+ *   OLSR 698, AODV 654, DSDV 269 over UDP) in band 0; everything else goes to band 1
+ * - Control band: FIFO; data band: FQ-CoDel (per-flow fairness, bounded sojourn)
+ * - Byte queue limits on the device queue, so packets wait in the queue disc
+ *   (where priority applies) rather than in the device's FIFO
+ * - Per-class counters over all devices: packets, drops, sojourn time (mean/max)
+ *
+ * Must be installed after the internet stack and before address assignment
+ * (which otherwise installs the default queue disc).
+ *
+ * Usage:
+ *   IslQueueDiscs qdiscs;
+ *   qdiscs.Install(islDevices);
+ *   islInterfaces = creator.AssignIslAddresses(islDevices);
+ *   ...
+ *   qdiscs.GetDrops(IslQueueDiscs::CONTROL);
+ */
+
+#ifndef ISL_QUEUE_DISC_H
+#define ISL_QUEUE_DISC_H
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/traffic-control-module.h"
+#include "ns3/ipv4-packet-filter.h"
+#include <array>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * Classifies routing protocol messages into band 0, other IPv4 packets into band 1
+ */
+class IslControlPacketFilter : public Ipv4PacketFilter {
+public:
+    static TypeId GetTypeId();
+
+    IslControlPacketFilter() = default;
+    ~IslControlPacketFilter() override = default;
+
+private:
+    int32_t DoClassify(Ptr<QueueDiscItem> item) const override;
+};
+
+class IslQueueDiscs {
+public:
+    enum Class { CONTROL = 0, DATA = 1, NUM_CLASSES = 2 };
+
+    IslQueueDiscs();
+
+    /**
+     * Install the priority queue disc on devices (internet stack required, no
+     * queue disc installed yet)
+     *
+     * @param devices ISL devices
+     * @param controlLimit Control band FIFO size
+     */
+    void Install(NetDeviceContainer devices, const std::string& controlLimit = "1000p");
+
+    /**
+     * Packets enqueued / dropped in a class (all devices)
+     */
+    uint64_t GetPackets(Class c) const;
+    uint64_t GetDrops(Class c) const;
+
+    /**
+     * Sojourn time of dequeued packets in a class (all devices)
+     */
+    Time GetMeanSojourn(Class c) const;
+    Time GetMaxSojourn(Class c) const { return m_maxSojourn[c]; }
+
+private:
+    void ControlSojourn(Time sojourn);
+    void DataSojourn(Time sojourn);
+
+    std::array<std::vector<Ptr<QueueDisc>>, NUM_CLASSES> m_children;
+    std::array<uint64_t, NUM_CLASSES> m_sojournCount;
+    std::array<Time, NUM_CLASSES> m_sojournSum;
+    std::array<Time, NUM_CLASSES> m_maxSojourn;
+};
+
+} // namespace ns3
+
+#endif // ISL_QUEUE_DISC_H
@@ -0,0 +1,174 @@
+/**
+ * ISL Snapshot Routing Implementation
+ *
+ * Precompute is pure geometry + Dijkstra (no simulator state); Apply only copies
+ * precomputed values into the running network.
+ */
+
+#include "isl-snapshot-routing.h"
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-model.h"
+#include "ns3/point-to-point-channel.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("IslSnapshotRouting");
+
+IslSnapshotRouting::IslSnapshotRouting(const WalkerDeltaConstellation& constellation,
+                                       const IslTopology& topology)
+    : m_constellation(constellation),
+      m_topology(topology),
+      m_links(topology.links),
+      m_maxInterPlaneLatitude(50.0 * M_PI / 180.0),
+      m_interval(0.0),
+      m_cache(nullptr),
+      m_cacheHit(false),
+      m_routing(nullptr),
+      m_applied(0),
+      m_linkTransitions(0) {
+    NS_ASSERT_MSG(constellation.GetNumSatellites() == topology.numSatellites,
+        "Constellation has " << constellation.GetNumSatellites() << " satellites, topology "
+        << topology.numSatellites);
+}
+
+bool IslSnapshotRouting::IsInterPlane(uint32_t link) const {
+    return m_constellation.GetPlane(m_links[link].first) != m_constellation.GetPlane(m_links[link].second);
+}
+
+void IslSnapshotRouting::Precompute(double interval, double stopTime) {
+    NS_LOG_FUNCTION(this << interval << stopTime);
+    NS_ASSERT_MSG(interval > 0.0, "Snapshot interval must be positive");
+
+    const double SPEED_OF_LIGHT = 299792458.0; // m/s
+    const uint32_t snapshots = std::max(1u, static_cast<uint32_t>(std::ceil(stopTime / interval)));
+    const uint32_t V = m_constellation.GetNumSatellites();
+
+    m_interval = interval;
+    m_linkDelay.assign(static_cast<size_t>(snapshots) * m_links.size(), -1.0);
+    m_tables.clear();
+    m_tables.reserve(snapshots);
+
+    // Link activity and delays (cheap geometry, always computed)
+    std::vector<double> latitude(V);
+    for (uint32_t k = 0; k < snapshots; ++k) {
+        double t = k * interval;
+        for (uint32_t sat = 0; sat < V; ++sat) {
+            latitude[sat] = std::fabs(m_constellation.GetLatitude(sat, t));
+        }
+
+        uint32_t active = 0;
+        for (uint32_t link = 0; link < m_links.size(); ++link) {
+            auto [a, b] = m_links[link];
+            bool up = !IsInterPlane(link) ||
+                (latitude[a] <= m_maxInterPlaneLatitude && latitude[b] <= m_maxInterPlaneLatitude);
+            m_linkDelay[static_cast<size_t>(k) * m_links.size() + link] =
+                up ? m_constellation.GetDistance(a, b, t) / SPEED_OF_LIGHT : -1.0;
+            active += up;
+        }
+        NS_LOG_DEBUG("Snapshot " << k << " (t=" << t << "s): " << active << "/" << m_links.size() << " links active");
+    }
+
+    // Next-hop tables (all-pairs Dijkstra per snapshot), from the cache when possible.
+    // The key covers everything the tables depend on except the run length; a cached
+    // sequence at least as long as this run is reused as a prefix.
+    uint64_t key = IslRouteTableCache::ComputeKey(m_topology, {
+        static_cast<double>(m_constellation.GetNumPlanes()),
+        static_cast<double>(m_constellation.GetSatsPerPlane()),
+        static_cast<double>(m_constellation.GetPhasing()),
+        m_constellation.GetOrbitRadius(),
+        m_constellation.GetInclination(),
+        interval,
+        m_maxInterPlaneLatitude});
+    m_cacheHit = m_cache && m_cache->Load(key, V, snapshots, m_tables);
+    if (m_cacheHit) {
+        NS_LOG_INFO("Loaded " << snapshots << " ISL snapshot tables from " << m_cache->GetPath(key));
+        return;
+    }
+
+    for (uint32_t k = 0; k < snapshots; ++k) {
+        std::vector<double> delays(m_linkDelay.begin() + static_cast<size_t>(k) * m_links.size(),
+                                   m_linkDelay.begin() + static_cast<size_t>(k + 1) * m_links.size());
+        m_tables.push_back(std::make_shared<const IslNextHopTable>(ComputeDelayWeightedRoutes(m_topology, delays)));
+    }
+    if (m_cache && !m_cache->Store(key, m_tables)) {
+        NS_LOG_WARN("Cannot store ISL snapshot tables in " << m_cache->GetPath(key));
+    }
+
+    NS_LOG_INFO("Precomputed " << snapshots << " ISL snapshots (" << interval << "s each)");
+}
+
+void IslSnapshotRouting::Install(NodeContainer satellites,
+                                 const NetDeviceContainer& islDevices,
+                                 IslTableRoutingHelper* routing) {
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(!m_tables.empty(), "Install() before Precompute()");
+    NS_ASSERT_MSG(islDevices.GetN() == m_links.size() * 2,
+        "ISL device count " << islDevices.GetN() << " does not match " << m_links.size() << " links");
+
+    m_satellites = satellites;
+    m_islDevices = islDevices;
+    m_routing = routing;
+
+    Apply(0);
+    for (uint32_t k = 1; k < m_tables.size(); ++k) {
+        Simulator::Schedule(Seconds(k * m_interval), &IslSnapshotRouting::Apply, this, k);
+    }
+}
+
+void IslSnapshotRouting::Apply(uint32_t snapshot) {
+    NS_LOG_FUNCTION(this << snapshot);
+
+    double t = snapshot * m_interval;
+    for (uint32_t sat = 0; sat < m_satellites.GetN(); ++sat) {
+        Ptr<MobilityModel> mobility = m_satellites.Get(sat)->GetObject<MobilityModel>();
+        if (mobility) {
+            mobility->SetPosition(m_constellation.GetPosition(sat, t));
+        }
+    }
+
+    uint32_t changed = 0;
+    for (uint32_t link = 0; link < m_links.size(); ++link) {
+        double delay = GetLinkDelay(snapshot, link);
+        bool up = delay >= 0.0;
+        bool wasUp = (snapshot == 0) || GetLinkDelay(snapshot - 1, link) >= 0.0;
+
+        Ptr<NetDevice> deviceA = m_islDevices.Get(link * 2);
+        if (up) {
+            Ptr<PointToPointChannel> channel = DynamicCast<PointToPointChannel>(deviceA->GetChannel());
+            if (channel) {
+                channel->SetAttribute("Delay", TimeValue(Seconds(delay)));
+            }
+        }
+        if (up == wasUp) continue;
+
+        // Both ends of the link follow its activity
+        for (uint32_t end = 0; end < 2; ++end) {
+            Ptr<NetDevice> device = m_islDevices.Get(link * 2 + end);
+            Ptr<Ipv4> ipv4 = device->GetNode()->GetObject<Ipv4>();
+            int32_t interface = ipv4 ? ipv4->GetInterfaceForDevice(device) : -1;
+            if (interface < 0) continue;
+            if (up) {
+                ipv4->SetUp(interface);
+            } else {
+                ipv4->SetDown(interface);
+            }
+        }
+        changed++;
+    }
+
+    if (m_routing) {
+        m_routing->SetTable(m_tables[snapshot]);
+    }
+    m_applied++;
+    m_linkTransitions += changed;
+
+    NS_LOG_INFO("t=" << Simulator::Now().GetSeconds() << "s: ISL snapshot " << snapshot
+        << " (" << changed << " link transitions)");
+}
+
+} // namespace ns3
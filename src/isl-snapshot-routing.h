@@ -0,0 +1,120 @@
+/**
+ * ISL Snapshot Routing
+ *
+ * Purpose: Time-expanded ISL routing for a moving constellation
+ * Features:
+ * - Run divided into fixed-length topology snapshots [k·Δ, (k+1)·Δ)
+ * - Per snapshot: link activity (inter-plane links off above a latitude limit)
+ *   and delay-weighted next hops from the link lengths at the snapshot start
+ * - All tables precomputed before Simulator::Run (per-packet cost stays a table lookup)
+ * - Optional on-disk cache (IslRouteTableCache): the tables do not depend on the
+ *   seed, so runs sharing a constellation load them instead of recomputing
+ * - At each boundary: satellite positions, channel delays and interface state are
+ *   updated and every satellite switches to the next table in one step
+ *
+ * Forwarding uses IslTableRouting alone. No static host routes are installed: an
+ * interface taken down here loses every Ipv4StaticRouting route through it, and
+ * SetUp() does not restore them, so a t = 0 fallback would not survive the first
+ * inter-plane deactivation. Pairs the table does not cover (partitioned) are dropped.
+ *
+ * Usage:
+ *   IslSnapshotRouting snapshots(constellation, topology);
+ *   snapshots.Precompute(10.0, simTime);
+ *   creator.RecordIslLinks(satNodes, islInterfaces);
+ *   islTableRouting.Install(satNodes, topology, creator, snapshots.GetTable(0));
+ *   snapshots.Install(satNodes, islDevices, &islTableRouting);
+ */
+
+#ifndef ISL_SNAPSHOT_ROUTING_H
+#define ISL_SNAPSHOT_ROUTING_H
+
+#include "ns3/node-container.h"
+#include "ns3/net-device-container.h"
+#include "isl-topology-generator.h"
+#include "isl-table-routing.h"
+#include "route-table-cache.h"
+#include "static-isl-routing.h"
+#include "walker-delta-constellation.h"
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace ns3 {
+
+class IslSnapshotRouting {
+public:
+    IslSnapshotRouting(const WalkerDeltaConstellation& constellation, const IslTopology& topology);
+
+    /**
+     * Inter-plane links are inactive while either endpoint is above this |latitude|
+     * (pointing/tracking limit of cross-plane terminals). Default 50°.
+     */
+    void SetMaxInterPlaneLatitude(double degrees) { m_maxInterPlaneLatitude = degrees * M_PI / 180.0; }
+
+    /**
+     * Load/store the next-hop tables through a cache (nullptr = always compute)
+     */
+    void SetRouteCache(const IslRouteTableCache* cache) { m_cache = cache; }
+
+    /**
+     * Compute link state and next-hop tables for snapshots starting at 0, Δ, 2Δ, ... < stopTime
+     *
+     * @param interval Snapshot length Δ (s)
+     * @param stopTime End of the run (s)
+     */
+    void Precompute(double interval, double stopTime);
+
+    /**
+     * Schedule the snapshot switches and apply snapshot 0 now
+     *
+     * @param satellites Satellite nodes (node ID = satellite ID)
+     * @param islDevices ISL devices (link i owns devices 2i and 2i+1)
+     * @param routing Table routing installed on the satellites
+     */
+    void Install(NodeContainer satellites,
+                 const NetDeviceContainer& islDevices,
+                 IslTableRoutingHelper* routing);
+
+    uint32_t GetNumSnapshots() const { return m_tables.size(); }
+    std::shared_ptr<const IslNextHopTable> GetTable(uint32_t snapshot) const { return m_tables.at(snapshot); }
+
+    /**
+     * @return Link delay in snapshot (s), or a negative value if the link is inactive
+     */
+    double GetLinkDelay(uint32_t snapshot, uint32_t link) const {
+        return m_linkDelay[static_cast<size_t>(snapshot) * m_links.size() + link];
+    }
+
+    bool IsCacheHit() const { return m_cacheHit; }
+    uint32_t GetAppliedSnapshots() const { return m_applied; }
+    uint64_t GetLinkTransitions() const { return m_linkTransitions; } // Links switched on/off at boundaries
+
+private:
+    /**
+     * Switch to snapshot k: positions, delays, interface state, forwarding table.
+     */
+    void Apply(uint32_t snapshot);
+
+    bool IsInterPlane(uint32_t link) const;
+
+    const WalkerDeltaConstellation& m_constellation;
+    IslTopology m_topology;
+    std::vector<std::pair<uint32_t, uint32_t>> m_links;  // m_topology.links
+    double m_maxInterPlaneLatitude;  // Radians
+    double m_interval;
+
+    std::vector<double> m_linkDelay;  // [snapshot × links + link], negative = inactive
+    std::vector<std::shared_ptr<const IslNextHopTable>> m_tables;
+    const IslRouteTableCache* m_cache;
+    bool m_cacheHit;
+
+    NodeContainer m_satellites;
+    NetDeviceContainer m_islDevices;
+    IslTableRoutingHelper* m_routing;
+    uint32_t m_applied;
+    uint64_t m_linkTransitions;
+};
+
+} // namespace ns3
+
+#endif // ISL_SNAPSHOT_ROUTING_H
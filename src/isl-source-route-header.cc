@@ -0,0 +1,80 @@
+/**
+ * ISL Source Route Header Implementation
+ */
+
+#include "isl-source-route-header.h"
+#include "ns3/assert.h"
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED(IslSourceRouteHeader);
+
+TypeId IslSourceRouteHeader::GetTypeId() {
+    static TypeId tid = TypeId("ns3::IslSourceRouteHeader")
+        .SetParent<Header>()
+        .SetGroupName("Internet")
+        .AddConstructor<IslSourceRouteHeader>();
+    return tid;
+}
+
+TypeId IslSourceRouteHeader::GetInstanceTypeId() const {
+    return GetTypeId();
+}
+
+IslSourceRouteHeader::IslSourceRouteHeader()
+    : m_protocol(0),
+      m_numHops(0),
+      m_next(0) {
+}
+
+void IslSourceRouteHeader::SetPath(const std::vector<uint8_t>& ports) {
+    NS_ASSERT_MSG(ports.size() <= MAX_HOPS, "Source route of " << ports.size() << " hops (max " << MAX_HOPS << ")");
+    m_numHops = static_cast<uint8_t>(ports.size());
+    m_next = 0;
+    m_packed.assign((ports.size() + 3) / 4, 0);
+    for (size_t i = 0; i < ports.size(); ++i) {
+        NS_ASSERT_MSG(ports[i] < 4, "Source route port " << static_cast<int>(ports[i]) << " does not fit 2 bits");
+        m_packed[i / 4] |= static_cast<uint8_t>(ports[i] << (2 * (i % 4)));
+    }
+}
+
+uint8_t IslSourceRouteHeader::PopPort() {
+    NS_ASSERT_MSG(m_next < m_numHops, "Source route exhausted");
+    uint8_t port = (m_packed[m_next / 4] >> (2 * (m_next % 4))) & 0x3;
+    m_next++;
+    return port;
+}
+
+uint32_t IslSourceRouteHeader::GetSerializedSize() const {
+    return 3 + static_cast<uint32_t>(m_packed.size());
+}
+
+void IslSourceRouteHeader::Serialize(Buffer::Iterator start) const {
+    start.WriteU8(m_protocol);
+    start.WriteU8(m_numHops);
+    start.WriteU8(m_next);
+    for (uint8_t byte : m_packed) {
+        start.WriteU8(byte);
+    }
+}
+
+uint32_t IslSourceRouteHeader::Deserialize(Buffer::Iterator start) {
+    m_protocol = start.ReadU8();
+    m_numHops = start.ReadU8();
+    m_next = start.ReadU8();
+    m_packed.resize((m_numHops + 3) / 4);
+    for (uint8_t& byte : m_packed) {
+        byte = start.ReadU8();
+    }
+    return GetSerializedSize();
+}
+
+void IslSourceRouteHeader::Print(std::ostream& os) const {
+    os << "protocol=" << static_cast<int>(m_protocol) << " hops=" << static_cast<int>(m_numHops)
+       << " next=" << static_cast<int>(m_next) << " ports=";
+    for (uint32_t i = 0; i < m_numHops; ++i) {
+        os << (i ? "," : "") << ((m_packed[i / 4] >> (2 * (i % 4))) & 0x3);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,70 @@
+/**
+ * ISL Source Route Header
+ *
+ * Purpose: Path header of IslSourceRouting, between the IP header and the transport header
+ * Features:
+ * - IP protocol 253 (RFC 3692 experimental); keeps the original protocol
+ * - One 2-bit port index per hop, 4 hops per byte, at most 255 hops
+ * - Separate from the routing protocol so packet classifiers can look past it
+ *
+ * Usage:
+ *   IslSourceRouteHeader path;
+ *   path.SetProtocol(17);
+ *   path.SetPath(ports);
+ *   packet->AddHeader(path);
+ */
+
+#ifndef ISL_SOURCE_ROUTE_HEADER_H
+#define ISL_SOURCE_ROUTE_HEADER_H
+
+#include "ns3/header.h"
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * Path header between the IP header and the transport header
+ *
+ * Wire format: original protocol (1 byte), hop count (1), next hop (1), then the
+ * port of hop i in bits 2·(i mod 4) of byte i / 4.
+ */
+class IslSourceRouteHeader : public Header {
+public:
+    static const uint8_t PROT_NUMBER = 253;  // RFC 3692 experimental
+    static const uint32_t MAX_HOPS = 255;
+
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+
+    IslSourceRouteHeader();
+
+    void SetProtocol(uint8_t protocol) { m_protocol = protocol; }
+    uint8_t GetProtocol() const { return m_protocol; }
+
+    /**
+     * @param ports Port index (0-3) per hop, ingress first (at most MAX_HOPS)
+     */
+    void SetPath(const std::vector<uint8_t>& ports);
+    uint32_t GetNumHops() const { return m_numHops; }
+    uint32_t GetHopsLeft() const { return m_numHops - m_next; }
+
+    /**
+     * Port of the next hop; advances to the hop after it
+     */
+    uint8_t PopPort();
+
+    uint32_t GetSerializedSize() const override;
+    void Serialize(Buffer::Iterator start) const override;
+    uint32_t Deserialize(Buffer::Iterator start) override;
+    void Print(std::ostream& os) const override;
+
+private:
+    uint8_t m_protocol;
+    uint8_t m_numHops;
+    uint8_t m_next;
+    std::vector<uint8_t> m_packed;
+};
+
+} // namespace ns3
+
+#endif // ISL_SOURCE_ROUTE_HEADER_H
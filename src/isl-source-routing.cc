@@ -0,0 +1,360 @@
+/**
+ * ISL Source Routing Implementation
+ *
+ * The only per-packet work in transit is removing a few header bytes, reading
+ * two bits and adding the header back; the next-hop table is read once per
+ * packet at the ingress satellite (and again only where a path hits a failed link).
+ */
+
+#include "isl-source-routing.h"
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/ipv4-list-routing.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("IslSourceRouting");
+
+NS_OBJECT_ENSURE_REGISTERED(IslSourceRouteL4);
+NS_OBJECT_ENSURE_REGISTERED(IslSourceRouting);
+
+// ============================================================================
+// IslSourceRouteL4
+// ============================================================================
+
+TypeId IslSourceRouteL4::GetTypeId() {
+    static TypeId tid = TypeId("ns3::IslSourceRouteL4")
+        .SetParent<IpL4Protocol>()
+        .SetGroupName("Internet")
+        .AddConstructor<IslSourceRouteL4>();
+    return tid;
+}
+
+IslSourceRouteL4::IslSourceRouteL4() {
+}
+
+void IslSourceRouteL4::DoDispose() {
+    m_ipv4 = nullptr;
+    m_downTarget.Nullify();
+    m_downTarget6.Nullify();
+    IpL4Protocol::DoDispose();
+}
+
+IpL4Protocol::RxStatus IslSourceRouteL4::Receive(Ptr<Packet> p,
+                                                 const Ipv4Header& header,
+                                                 Ptr<Ipv4Interface> incomingInterface) {
+    NS_LOG_FUNCTION(this << p << header.GetSource() << header.GetDestination());
+
+    IslSourceRouteHeader path;
+    p->RemoveHeader(path);
+
+    // Hand the payload to the original transport protocol as if never stamped
+    Ipv4Header inner = header;
+    inner.SetProtocol(path.GetProtocol());
+    inner.SetPayloadSize(p->GetSize());
+
+    int32_t interface = m_ipv4->GetInterfaceForDevice(incomingInterface->GetDevice());
+    Ptr<IpL4Protocol> protocol = m_ipv4->GetProtocol(path.GetProtocol(), interface);
+    if (!protocol) {
+        NS_LOG_WARN("No protocol " << static_cast<int>(path.GetProtocol()) << " for source-routed packet");
+        return IpL4Protocol::RX_ENDPOINT_UNREACH;
+    }
+    return protocol->Receive(p, inner, incomingInterface);
+}
+
+IpL4Protocol::RxStatus IslSourceRouteL4::Receive(Ptr<Packet> p,
+                                                 const Ipv6Header& header,
+                                                 Ptr<Ipv6Interface> incomingInterface) {
+    // ISLs are IPv4 only
+    return IpL4Protocol::RX_ENDPOINT_UNREACH;
+}
+
+// ============================================================================
+// IslSourceRouting
+// ============================================================================
+
+TypeId IslSourceRouting::GetTypeId() {
+    static TypeId tid = TypeId("ns3::IslSourceRouting")
+        .SetParent<Ipv4RoutingProtocol>()
+        .SetGroupName("Internet")
+        .AddConstructor<IslSourceRouting>();
+    return tid;
+}
+
+IslSourceRouting::IslSourceRouting()
+    : m_satId(UINT32_MAX),
+      m_stamped(0),
+      m_transit(0),
+      m_restamped(0),
+      m_unstamped(0),
+      m_stampedHops(0) {
+}
+
+void IslSourceRouting::DoDispose() {
+    m_ipv4 = nullptr;
+    m_table.reset();
+    m_neighbors.reset();
+    m_addressToSat.reset();
+    Ipv4RoutingProtocol::DoDispose();
+}
+
+void IslSourceRouting::Configure(uint32_t satId,
+                                 std::vector<IslPort> ports,
+                                 std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> addressToSat,
+                                 std::shared_ptr<const std::vector<std::vector<uint32_t>>> neighbors,
+                                 std::shared_ptr<const IslNextHopTable> table) {
+    NS_ASSERT_MSG(ports.size() <= 4, "Sat " << satId << " has " << ports.size() << " ISL ports (2-bit ports: max 4)");
+    m_satId = satId;
+    m_ports = std::move(ports);
+    m_addressToSat = std::move(addressToSat);
+    m_neighbors = std::move(neighbors);
+    m_table = std::move(table);
+}
+
+bool IslSourceRouting::BuildPath(uint32_t dst, std::vector<uint8_t>& ports) const {
+    ports.clear();
+    if (!m_table || !m_neighbors) return false;
+
+    const uint32_t maxHops = std::min<uint32_t>(IslSourceRouteHeader::MAX_HOPS, m_table->GetNumSatellites());
+    uint32_t cur = m_satId;
+    while (cur != dst) {
+        if (ports.size() >= maxHops) return false;  // Loop in the table
+
+        uint8_t mask = m_table->GetPorts(cur, dst);
+        if (cur == m_satId) {
+            // Failed local links are known here; those further along are not
+            for (uint32_t p = 0; p < m_ports.size(); ++p) {
+                if ((mask & (1u << p)) && !m_ipv4->IsUp(m_ports[p].interface)) {
+                    mask &= static_cast<uint8_t>(~(1u << p));
+                }
+            }
+        }
+        if (mask == 0) return false;
+
+        const std::vector<uint32_t>& neighbors = (*m_neighbors)[cur];
+        uint32_t port = static_cast<uint32_t>(__builtin_ctz(mask));
+        if (port >= neighbors.size() || port >= 4) return false;
+        ports.push_back(static_cast<uint8_t>(port));
+        cur = neighbors[port];
+    }
+    return !ports.empty();
+}
+
+Ptr<Ipv4Route> IslSourceRouting::PortRoute(const Ipv4Header& header, uint8_t port) const {
+    const IslPort& out = m_ports[port];
+    Ptr<Ipv4Route> route = Create<Ipv4Route>();
+    route->SetDestination(header.GetDestination());
+    route->SetGateway(out.gateway);
+    route->SetOutputDevice(m_ipv4->GetNetDevice(out.interface));
+    route->SetSource(m_ipv4->GetAddress(out.interface, 0).GetLocal());
+    return route;
+}
+
+IslSourceRouting::Forwarded IslSourceRouting::Stamp(Ptr<const Packet> payload, const Ipv4Header& header,
+                                                    uint8_t protocol, uint32_t dst,
+                                                    const UnicastForwardCallback& ucb, bool stamp) {
+    std::vector<uint8_t> ports;
+    if (!BuildPath(dst, ports)) return NOT_FORWARDED;
+
+    IslSourceRouteHeader path;
+    path.SetProtocol(protocol);
+    path.SetPath(ports);
+    uint8_t port = path.PopPort();
+
+    Ptr<Packet> packet = payload->Copy();
+    Ipv4Header out = header;
+    const uint32_t stampedSize = header.GetSerializedSize() + payload->GetSize() + path.GetSerializedSize();
+    stamp = stamp && stampedSize <= m_ipv4->GetMtu(m_ports[port].interface);
+    if (stamp) {
+        packet->AddHeader(path);
+        out.SetProtocol(IslSourceRouteHeader::PROT_NUMBER);
+        m_stampedHops += ports.size();
+    } else {
+        // Fragment, or would be fragmented after stamping: the next satellite routes it again
+        out.SetProtocol(protocol);
+    }
+    out.SetPayloadSize(packet->GetSize());
+    ucb(PortRoute(out, port), packet, out);
+    return stamp ? STAMPED : UNSTAMPED;
+}
+
+Ptr<Ipv4Route> IslSourceRouting::RouteOutput(Ptr<Packet> p,
+                                             const Ipv4Header& header,
+                                             Ptr<NetDevice> oif,
+                                             Socket::SocketErrno& sockerr) {
+    NS_LOG_FUNCTION(this << header.GetDestination());
+
+    // The transport header is not attached yet: loop the packet back and stamp it
+    // in RouteInput. Source address = first hop's interface, as a direct route would pick.
+    std::vector<uint8_t> ports;
+    if (!oif && m_addressToSat) {
+        auto it = m_addressToSat->find(header.GetDestination().Get());
+        if (it != m_addressToSat->end() && it->second != m_satId && BuildPath(it->second, ports)) {
+            Ptr<Ipv4Route> route = Create<Ipv4Route>();
+            route->SetDestination(header.GetDestination());
+            route->SetGateway(Ipv4Address::GetLoopback());
+            route->SetOutputDevice(m_ipv4->GetNetDevice(0));
+            route->SetSource(m_ipv4->GetAddress(m_ports[ports[0]].interface, 0).GetLocal());
+            sockerr = Socket::ERROR_NOTERROR;
+            return route;
+        }
+    }
+    sockerr = Socket::ERROR_NOROUTETOHOST;
+    return nullptr;
+}
+
+bool IslSourceRouting::RouteInput(Ptr<const Packet> p,
+                                  const Ipv4Header& header,
+                                  Ptr<const NetDevice> idev,
+                                  const UnicastForwardCallback& ucb,
+                                  const MulticastForwardCallback& mcb,
+                                  const LocalDeliverCallback& lcb,
+                                  const ErrorCallback& ecb) {
+    NS_LOG_FUNCTION(this << header.GetDestination());
+
+    // Local delivery and multicast are handled by Ipv4ListRouting / Ipv4StaticRouting
+    if (header.GetDestination().IsMulticast() || header.GetDestination().IsBroadcast()) {
+        return false;
+    }
+    if (!m_addressToSat) return false;
+    auto it = m_addressToSat->find(header.GetDestination().Get());
+    if (it == m_addressToSat->end() || it->second == m_satId) return false;
+
+    // Fragments are forwarded as they are: one with a nonzero offset starts inside the
+    // payload, not with a path header, and a path added to any fragment would end up
+    // inside the reassembled packet
+    const bool fragment = header.GetFragmentOffset() != 0 || !header.IsLastFragment();
+    if (header.GetProtocol() != IslSourceRouteHeader::PROT_NUMBER || fragment) {
+        // Ingress (own packets via loopback, or entering the ISL mesh here)
+        Forwarded forwarded = Stamp(p, header, header.GetProtocol(), it->second, ucb, !fragment);
+        if (forwarded == NOT_FORWARDED) return false;
+        (forwarded == STAMPED ? m_stamped : m_unstamped)++;
+        return true;
+    }
+
+    // Transit: pop the next port
+    Ptr<Packet> packet = p->Copy();
+    IslSourceRouteHeader path;
+    packet->RemoveHeader(path);
+    if (path.GetHopsLeft() > 0) {
+        uint8_t port = path.PopPort();
+        if (port < m_ports.size() && m_ipv4->IsUp(m_ports[port].interface)) {
+            packet->AddHeader(path);
+            m_transit++;
+            ucb(PortRoute(header, port), packet, header);
+            return true;
+        }
+    }
+
+    // Path exhausted or its next link is down: new path from here. There are no static
+    // host routes behind this protocol, so with no path the packet is dropped.
+    Forwarded forwarded = Stamp(packet, header, path.GetProtocol(), it->second, ucb);
+    if (forwarded != NOT_FORWARDED) {
+        (forwarded == STAMPED ? m_restamped : m_unstamped)++;
+        return true;
+    }
+    Ipv4Header original = header;
+    original.SetProtocol(path.GetProtocol());
+    original.SetPayloadSize(packet->GetSize());
+    ecb(packet, original, Socket::ERROR_NOROUTETOHOST);
+    return true;
+}
+
+void IslSourceRouting::PrintRoutingTable(Ptr<OutputStreamWrapper> stream, Time::Unit unit) const {
+    std::ostream* os = stream->GetStream();
+    *os << "IslSourceRouting: Sat " << m_satId << ", " << m_ports.size() << " ports, "
+        << m_stamped << " paths stamped, " << m_transit << " transit packets, "
+        << m_restamped << " re-stamped, " << m_unstamped << " forwarded unstamped\n";
+}
+
+// ============================================================================
+// IslSourceRoutingHelper
+// ============================================================================
+
+void IslSourceRoutingHelper::Install(NodeContainer satellites,
+                                     const IslTopology& topology,
+                                     const IslNetworkCreator& creator,
+                                     std::shared_ptr<const IslNextHopTable> table) {
+    NS_LOG_FUNCTION(this);
+
+    auto addressToSat = creator.GetAddressToSatellite();
+    auto neighbors = std::make_shared<std::vector<std::vector<uint32_t>>>(topology.numSatellites);
+    for (const auto& [sat, list] : topology.neighbors) {
+        if (sat < neighbors->size()) (*neighbors)[sat] = list;
+    }
+
+    m_protocols.clear();
+    for (uint32_t sat = 0; sat < satellites.GetN(); ++sat) {
+        Ptr<Node> node = satellites.Get(sat);
+        Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+
+        std::vector<IslPort> ports = creator.GetIslPorts(sat, topology.neighbors.at(sat));
+
+        Ptr<Ipv4ListRouting> list = DynamicCast<Ipv4ListRouting>(ipv4->GetRoutingProtocol());
+        NS_ASSERT_MSG(list, "Sat " << sat << " has no Ipv4ListRouting");
+
+        Ptr<IslSourceRouting> routing = CreateObject<IslSourceRouting>();
+        routing->Configure(sat, std::move(ports), addressToSat, neighbors, table);
+        list->AddRoutingProtocol(routing, 10); // Above Ipv4StaticRouting (0)
+        m_protocols.push_back(routing);
+
+        // Destination side: strip the path header before UDP/TCP
+        Ptr<IslSourceRouteL4> l4 = CreateObject<IslSourceRouteL4>();
+        l4->SetIpv4(ipv4);
+        ipv4->Insert(l4);
+    }
+
+    NS_LOG_INFO("Installed IslSourceRouting on " << m_protocols.size() << " satellites");
+}
+
+void IslSourceRoutingHelper::SetTable(std::shared_ptr<const IslNextHopTable> table) {
+    for (Ptr<IslSourceRouting> routing : m_protocols) {
+        routing->SetTable(table);
+    }
+}
+
+uint64_t IslSourceRoutingHelper::GetStampedPackets() const {
+    uint64_t total = 0;
+    for (Ptr<IslSourceRouting> routing : m_protocols) {
+        total += routing->GetStampedPackets();
+    }
+    return total;
+}
+
+uint64_t IslSourceRoutingHelper::GetTransitPackets() const {
+    uint64_t total = 0;
+    for (Ptr<IslSourceRouting> routing : m_protocols) {
+        total += routing->GetTransitPackets();
+    }
+    return total;
+}
+
+uint64_t IslSourceRoutingHelper::GetRestampedPackets() const {
+    uint64_t total = 0;
+    for (Ptr<IslSourceRouting> routing : m_protocols) {
+        total += routing->GetRestampedPackets();
+    }
+    return total;
+}
+
+uint64_t IslSourceRoutingHelper::GetUnstampedPackets() const {
+    uint64_t total = 0;
+    for (Ptr<IslSourceRouting> routing : m_protocols) {
+        total += routing->GetUnstampedPackets();
+    }
+    return total;
+}
+
+double IslSourceRoutingHelper::GetMeanPathLength() const {
+    uint64_t paths = 0;
+    uint64_t hops = 0;
+    for (Ptr<IslSourceRouting> routing : m_protocols) {
+        paths += routing->GetStampedPackets() + routing->GetRestampedPackets();
+        hops += routing->GetStampedHops();
+    }
+    return paths > 0 ? static_cast<double>(hops) / paths : 0.0;
+}
+
+} // namespace ns3
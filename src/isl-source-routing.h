@@ -0,0 +1,210 @@
+/**
+ * ISL Source Routing
+ *
+ * Purpose: Table-free transit forwarding from a path stamped at the ingress satellite
+ * Features:
+ * - The ingress satellite walks the shared next-hop table (IslNextHopTable) once and
+ *   writes the whole path into an IslSourceRouteHeader: one 2-bit port index (position
+ *   in topology.neighbors[sat]) per hop, 4 hops per byte
+ * - Transit satellites pop the next port and forward: no table lookup, no per-destination
+ *   state, constant time
+ * - Stamped packets carry IP protocol 253 (experimental); the header keeps the original
+ *   protocol, and IslSourceRouteL4 at the destination strips the header and hands the
+ *   packet to UDP/TCP unchanged
+ * - Packets sent by the satellite itself are looped back once (as AODV does for deferred
+ *   routes) so the path is stamped after the transport header is attached
+ * - A popped port whose interface is down: the path is re-stamped from the current
+ *   satellite (table repaired by IncrementalIslRoutes); no path at all falls through to
+ *   Ipv4StaticRouting, which holds only the connected routes (no V host routes per satellite)
+ * - Never stamped, forwarded hop by hop along the table instead: IP fragments (only the
+ *   first would carry the path, and a path added to one ends up inside the reassembled
+ *   payload) and packets that the path header would push over the first hop's MTU
+ *
+ * Usage:
+ *   auto table = std::make_shared<IslNextHopTable>(topology.numSatellites);
+ *   incrementalRoutes->FillNextHopTable(*table, false);
+ *   IslSourceRoutingHelper helper;
+ *   helper.Install(satellites, topology, creator, table);   // after RecordIslLinks
+ */
+
+#ifndef ISL_SOURCE_ROUTING_H
+#define ISL_SOURCE_ROUTING_H
+
+#include "ns3/ip-l4-protocol.h"
+#include "ns3/ipv4-routing-protocol.h"
+#include "ns3/ipv4.h"
+#include "ns3/node-container.h"
+#include "isl-source-route-header.h"
+#include "isl-topology-generator.h"
+#include "isl-network-creator.h"
+#include "isl-table-routing.h"
+#include "static-isl-routing.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * Destination side of protocol 253: strips IslSourceRouteHeader and delivers the
+ * payload to the original transport protocol
+ */
+class IslSourceRouteL4 : public IpL4Protocol {
+public:
+    static TypeId GetTypeId();
+
+    IslSourceRouteL4();
+    ~IslSourceRouteL4() override = default;
+
+    void SetIpv4(Ptr<Ipv4> ipv4) { m_ipv4 = ipv4; }
+
+    // IpL4Protocol
+    int GetProtocolNumber() const override { return IslSourceRouteHeader::PROT_NUMBER; }
+    RxStatus Receive(Ptr<Packet> p, const Ipv4Header& header, Ptr<Ipv4Interface> incomingInterface) override;
+    RxStatus Receive(Ptr<Packet> p, const Ipv6Header& header, Ptr<Ipv6Interface> incomingInterface) override;
+    void SetDownTarget(IpL4Protocol::DownTargetCallback cb) override { m_downTarget = cb; }
+    void SetDownTarget6(IpL4Protocol::DownTargetCallback6 cb) override { m_downTarget6 = cb; }
+    IpL4Protocol::DownTargetCallback GetDownTarget() const override { return m_downTarget; }
+    IpL4Protocol::DownTargetCallback6 GetDownTarget6() const override { return m_downTarget6; }
+
+protected:
+    void DoDispose() override;
+
+private:
+    Ptr<Ipv4> m_ipv4;
+    IpL4Protocol::DownTargetCallback m_downTarget;
+    IpL4Protocol::DownTargetCallback6 m_downTarget6;
+};
+
+class IslSourceRouting : public Ipv4RoutingProtocol {
+public:
+    static TypeId GetTypeId();
+
+    IslSourceRouting();
+    ~IslSourceRouting() override = default;
+
+    /**
+     * @param satId This satellite's ID
+     * @param ports ISL ports in neighbor list order (at most 4)
+     * @param addressToSat Any satellite address (host order) → satellite ID
+     * @param neighbors Neighbor lists of all satellites (path walk at the ingress)
+     * @param table Shared next-hop table (read at the ingress only)
+     */
+    void Configure(uint32_t satId,
+                   std::vector<IslPort> ports,
+                   std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> addressToSat,
+                   std::shared_ptr<const std::vector<std::vector<uint32_t>>> neighbors,
+                   std::shared_ptr<const IslNextHopTable> table);
+
+    void SetTable(std::shared_ptr<const IslNextHopTable> table) { m_table = std::move(table); }
+
+    uint64_t GetStampedPackets() const { return m_stamped; }
+    uint64_t GetTransitPackets() const { return m_transit; }
+    uint64_t GetRestampedPackets() const { return m_restamped; }
+    uint64_t GetUnstampedPackets() const { return m_unstamped; }
+    uint64_t GetStampedHops() const { return m_stampedHops; }
+
+    // Ipv4RoutingProtocol
+    Ptr<Ipv4Route> RouteOutput(Ptr<Packet> p,
+                               const Ipv4Header& header,
+                               Ptr<NetDevice> oif,
+                               Socket::SocketErrno& sockerr) override;
+    bool RouteInput(Ptr<const Packet> p,
+                    const Ipv4Header& header,
+                    Ptr<const NetDevice> idev,
+                    const UnicastForwardCallback& ucb,
+                    const MulticastForwardCallback& mcb,
+                    const LocalDeliverCallback& lcb,
+                    const ErrorCallback& ecb) override;
+    void NotifyInterfaceUp(uint32_t interface) override {}
+    void NotifyInterfaceDown(uint32_t interface) override {}
+    void NotifyAddAddress(uint32_t interface, Ipv4InterfaceAddress address) override {}
+    void NotifyRemoveAddress(uint32_t interface, Ipv4InterfaceAddress address) override {}
+    void SetIpv4(Ptr<Ipv4> ipv4) override { m_ipv4 = ipv4; }
+    void PrintRoutingTable(Ptr<OutputStreamWrapper> stream, Time::Unit unit = Time::S) const override;
+
+protected:
+    void DoDispose() override;
+
+private:
+    enum Forwarded { NOT_FORWARDED, STAMPED, UNSTAMPED };
+
+    /**
+     * Path from this satellite to dst along the table's first next hop; the first port
+     * skips interfaces that are down (local knowledge only)
+     *
+     * @return false if the table has no loop-free path of at most MAX_HOPS
+     */
+    bool BuildPath(uint32_t dst, std::vector<uint8_t>& ports) const;
+
+    /**
+     * Route out of a port towards header's destination
+     */
+    Ptr<Ipv4Route> PortRoute(const Ipv4Header& header, uint8_t port) const;
+
+    /**
+     * Stamp a fresh path from this satellite and forward; without stamp, or if the
+     * stamped packet would exceed the first hop's MTU, forward it unstamped to the
+     * first hop instead
+     *
+     * @param protocol Transport protocol (the IP header's, unless already stamped)
+     * @return NOT_FORWARDED if the table has no path
+     */
+    Forwarded Stamp(Ptr<const Packet> payload, const Ipv4Header& header, uint8_t protocol, uint32_t dst,
+                    const UnicastForwardCallback& ucb, bool stamp = true);
+
+    Ptr<Ipv4> m_ipv4;
+    uint32_t m_satId;
+    std::vector<IslPort> m_ports;
+    std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> m_addressToSat;
+    std::shared_ptr<const std::vector<std::vector<uint32_t>>> m_neighbors;
+    std::shared_ptr<const IslNextHopTable> m_table;
+    uint64_t m_stamped;
+    uint64_t m_transit;
+    uint64_t m_restamped;
+    uint64_t m_unstamped;
+    uint64_t m_stampedHops;
+};
+
+/**
+ * Installs IslSourceRouting and IslSourceRouteL4 on all satellites
+ */
+class IslSourceRoutingHelper {
+public:
+    /**
+     * Add IslSourceRouting (priority 10) to every satellite's Ipv4ListRouting and
+     * register protocol 253 for delivery
+     *
+     * @param satellites Satellite nodes (node ID = satellite ID)
+     * @param topology ISL topology (port order, at most 4 neighbors per satellite)
+     * @param creator Network creator after InstallStaticRoutes (link/interface map)
+     * @param table Next-hop table the ingress paths are read from
+     */
+    void Install(NodeContainer satellites,
+                 const IslTopology& topology,
+                 const IslNetworkCreator& creator,
+                 std::shared_ptr<const IslNextHopTable> table);
+
+    void SetTable(std::shared_ptr<const IslNextHopTable> table);
+
+    uint64_t GetStampedPackets() const;
+    uint64_t GetTransitPackets() const;
+    uint64_t GetRestampedPackets() const;
+
+    /**
+     * Forwarding decisions for fragments and oversized packets (one per satellite passed)
+     */
+    uint64_t GetUnstampedPackets() const;
+
+    /**
+     * Mean stamped path length (hops), 0 if nothing was stamped
+     */
+    double GetMeanPathLength() const;
+
+private:
+    std::vector<Ptr<IslSourceRouting>> m_protocols;
+};
+
+} // namespace ns3
+
+#endif // ISL_SOURCE_ROUTING_H
@@ -0,0 +1,206 @@
+/**
+ * ISL Table Routing Implementation
+ *
+ * Forwarding is a table row lookup plus a hash: no per-destination route entries
+ * are stored on the satellites, so table updates (failure repair, snapshots) are
+ * visible to every node at once.
+ */
+
+#include "isl-table-routing.h"
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/ipv4-list-routing.h"
+#include "ns3/log.h"
+#include <iomanip>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("IslTableRouting");
+
+NS_OBJECT_ENSURE_REGISTERED(IslTableRouting);
+
+TypeId IslTableRouting::GetTypeId() {
+    static TypeId tid = TypeId("ns3::IslTableRouting")
+        .SetParent<Ipv4RoutingProtocol>()
+        .SetGroupName("Internet")
+        .AddConstructor<IslTableRouting>();
+    return tid;
+}
+
+IslTableRouting::IslTableRouting()
+    : m_satId(UINT32_MAX),
+      m_forwarded(0) {
+}
+
+void IslTableRouting::DoDispose() {
+    m_ipv4 = nullptr;
+    m_table.reset();
+    m_addressToSat.reset();
+    Ipv4RoutingProtocol::DoDispose();
+}
+
+void IslTableRouting::Configure(uint32_t satId,
+                                std::vector<IslPort> ports,
+                                std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> addressToSat,
+                                std::shared_ptr<const IslNextHopTable> table) {
+    NS_ASSERT_MSG(ports.size() <= IslNextHopTable::MAX_PORTS,
+        "Sat " << satId << " has " << ports.size() << " ISL ports (max " << IslNextHopTable::MAX_PORTS << ")");
+    m_satId = satId;
+    m_ports = std::move(ports);
+    m_addressToSat = std::move(addressToSat);
+    m_table = std::move(table);
+}
+
+uint32_t IslTableRouting::HashFlow(const Ipv4Header& header, uint16_t srcPort, uint16_t dstPort) const {
+    // 64-bit mix (SplitMix finalizer) of the packed tuple
+    uint64_t h = (static_cast<uint64_t>(header.GetSource().Get()) << 32) | header.GetDestination().Get();
+    h ^= (static_cast<uint64_t>(srcPort) << 40) ^ (static_cast<uint64_t>(dstPort) << 24)
+       ^ (static_cast<uint64_t>(header.GetProtocol()) << 8) ^ (static_cast<uint64_t>(m_satId) * 0x9e3779b97f4a7c15ULL);
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<uint32_t>(h ^ (h >> 31));
+}
+
+Ptr<Ipv4Route> IslTableRouting::Lookup(const Ipv4Header& header, uint32_t flowHash) const {
+    if (!m_table || !m_addressToSat) return nullptr;
+
+    auto it = m_addressToSat->find(header.GetDestination().Get());
+    if (it == m_addressToSat->end() || it->second == m_satId) return nullptr;
+
+    // Drop ports whose interface is down (failure not yet repaired in the table)
+    uint8_t ports = m_table->GetPorts(m_satId, it->second);
+    for (uint32_t p = 0; p < m_ports.size(); ++p) {
+        if ((ports & (1u << p)) && !m_ipv4->IsUp(m_ports[p].interface)) {
+            ports &= static_cast<uint8_t>(~(1u << p));
+        }
+    }
+    if (ports == 0) return nullptr;
+
+    // Pick the (hash mod k)-th set bit
+    uint32_t k = flowHash % static_cast<uint32_t>(__builtin_popcount(ports));
+    uint32_t port = 0;
+    for (; port < m_ports.size(); ++port) {
+        if ((ports & (1u << port)) && k-- == 0) break;
+    }
+
+    const IslPort& out = m_ports[port];
+    Ptr<Ipv4Route> route = Create<Ipv4Route>();
+    route->SetDestination(header.GetDestination());
+    route->SetGateway(out.gateway);
+    route->SetOutputDevice(m_ipv4->GetNetDevice(out.interface));
+    route->SetSource(m_ipv4->GetAddress(out.interface, 0).GetLocal());
+    return route;
+}
+
+Ptr<Ipv4Route> IslTableRouting::RouteOutput(Ptr<Packet> p,
+                                            const Ipv4Header& header,
+                                            Ptr<NetDevice> oif,
+                                            Socket::SocketErrno& sockerr) {
+    NS_LOG_FUNCTION(this << header.GetDestination());
+
+    Ptr<Ipv4Route> route;
+    if (!oif) {
+        route = Lookup(header, HashFlow(header, 0, 0));
+    }
+    sockerr = route ? Socket::ERROR_NOTERROR : Socket::ERROR_NOROUTETOHOST;
+    return route;
+}
+
+bool IslTableRouting::RouteInput(Ptr<const Packet> p,
+                                 const Ipv4Header& header,
+                                 Ptr<const NetDevice> idev,
+                                 const UnicastForwardCallback& ucb,
+                                 const MulticastForwardCallback& mcb,
+                                 const LocalDeliverCallback& lcb,
+                                 const ErrorCallback& ecb) {
+    NS_LOG_FUNCTION(this << header.GetDestination());
+
+    // Local delivery and multicast are handled by Ipv4ListRouting / Ipv4StaticRouting
+    if (header.GetDestination().IsMulticast() || header.GetDestination().IsBroadcast()) {
+        return false;
+    }
+
+    // Transport ports (UDP and TCP both start with source/destination port)
+    uint16_t srcPort = 0;
+    uint16_t dstPort = 0;
+    uint8_t protocol = header.GetProtocol();
+    if ((protocol == 17 || protocol == 6) && header.GetFragmentOffset() == 0 && p->GetSize() >= 4) {
+        uint8_t buf[4];
+        p->CopyData(buf, 4);
+        srcPort = static_cast<uint16_t>((buf[0] << 8) | buf[1]);
+        dstPort = static_cast<uint16_t>((buf[2] << 8) | buf[3]);
+    }
+
+    Ptr<Ipv4Route> route = Lookup(header, HashFlow(header, srcPort, dstPort));
+    if (!route) return false;
+
+    m_forwarded++;
+    ucb(route, p, header);
+    return true;
+}
+
+void IslTableRouting::PrintRoutingTable(Ptr<OutputStreamWrapper> stream, Time::Unit unit) const {
+    std::ostream* os = stream->GetStream();
+    *os << "IslTableRouting: Sat " << m_satId << ", " << m_ports.size() << " ports, "
+        << m_forwarded << " packets forwarded\n";
+    if (!m_table) return;
+
+    *os << "  dst  ports (next hops)\n";
+    for (uint32_t dst = 0; dst < m_table->GetNumSatellites(); ++dst) {
+        uint8_t ports = m_table->GetPorts(m_satId, dst);
+        if (ports == 0) continue;
+        *os << "  " << std::setw(3) << dst << " ";
+        for (uint32_t p = 0; p < m_ports.size(); ++p) {
+            if (ports & (1u << p)) *os << " " << m_ports[p].neighbor;
+        }
+        *os << "\n";
+    }
+}
+
+// ============================================================================
+// IslTableRoutingHelper
+// ============================================================================
+
+void IslTableRoutingHelper::Install(NodeContainer satellites,
+                                    const IslTopology& topology,
+                                    const IslNetworkCreator& creator,
+                                    std::shared_ptr<const IslNextHopTable> table) {
+    NS_LOG_FUNCTION(this);
+
+    auto addressToSat = creator.GetAddressToSatellite();
+
+    m_protocols.clear();
+    for (uint32_t sat = 0; sat < satellites.GetN(); ++sat) {
+        Ptr<Node> node = satellites.Get(sat);
+        Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+
+        std::vector<IslPort> ports = creator.GetIslPorts(sat, topology.neighbors.at(sat));
+
+        Ptr<Ipv4ListRouting> list = DynamicCast<Ipv4ListRouting>(ipv4->GetRoutingProtocol());
+        NS_ASSERT_MSG(list, "Sat " << sat << " has no Ipv4ListRouting");
+
+        Ptr<IslTableRouting> routing = CreateObject<IslTableRouting>();
+        routing->Configure(sat, std::move(ports), addressToSat, table);
+        list->AddRoutingProtocol(routing, 10); // Above Ipv4StaticRouting (0)
+        m_protocols.push_back(routing);
+    }
+
+    NS_LOG_INFO("Installed IslTableRouting on " << m_protocols.size() << " satellites");
+}
+
+void IslTableRoutingHelper::SetTable(std::shared_ptr<const IslNextHopTable> table) {
+    for (Ptr<IslTableRouting> routing : m_protocols) {
+        routing->SetTable(table);
+    }
+}
+
+uint64_t IslTableRoutingHelper::GetForwardedPackets() const {
+    uint64_t total = 0;
+    for (Ptr<IslTableRouting> routing : m_protocols) {
+        total += routing->GetForwardedPackets();
+    }
+    return total;
+}
+
+} // namespace ns3
@@ -0,0 +1,135 @@
+/**
+ * ISL Table Routing
+ *
+ * Purpose: Forward ISL traffic from a shared next-hop port table (IslNextHopTable)
+ * Features:
+ * - Single-path or ECMP forwarding (flows hashed across all equal-cost ports)
+ * - One table shared by all satellites (V² bytes total, swappable at run time)
+ * - Ports whose interface is down are skipped (local failover before route repair)
+ * - Added to each satellite's Ipv4ListRouting above Ipv4StaticRouting, which stays
+ *   installed as fallback (connected /30 networks, unknown destinations)
+ *
+ * Flow hashing:
+ * - Transit (RouteInput): 5-tuple (addresses, protocol, UDP/TCP ports)
+ * - Origin (RouteOutput): 3-tuple; the transport header is not yet attached there
+ * - The hash is salted with the satellite ID so consecutive hops split independently
+ *
+ * Usage:
+ *   auto table = std::make_shared<IslNextHopTable>(ComputeEcmpRoutes(topology));
+ *   IslTableRoutingHelper helper;
+ *   helper.Install(satellites, topology, creator, table);   // after InstallStaticRoutes
+ */
+
+#ifndef ISL_TABLE_ROUTING_H
+#define ISL_TABLE_ROUTING_H
+
+#include "ns3/ipv4-routing-protocol.h"
+#include "ns3/ipv4.h"
+#include "ns3/node-container.h"
+#include "isl-topology-generator.h"
+#include "isl-network-creator.h"
+#include "static-isl-routing.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+class IslTableRouting : public Ipv4RoutingProtocol {
+public:
+    static TypeId GetTypeId();
+
+    IslTableRouting();
+    ~IslTableRouting() override = default;
+
+    /**
+     * @param satId This satellite's ID (row of the table)
+     * @param ports ISL ports in neighbor list order
+     * @param addressToSat Any satellite address (host order) → satellite ID
+     * @param table Shared next-hop table
+     */
+    void Configure(uint32_t satId,
+                   std::vector<IslPort> ports,
+                   std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> addressToSat,
+                   std::shared_ptr<const IslNextHopTable> table);
+
+    /**
+     * Replace the next-hop table (e.g. at a topology snapshot boundary)
+     */
+    void SetTable(std::shared_ptr<const IslNextHopTable> table) { m_table = std::move(table); }
+
+    uint64_t GetForwardedPackets() const { return m_forwarded; }
+
+    // Ipv4RoutingProtocol
+    Ptr<Ipv4Route> RouteOutput(Ptr<Packet> p,
+                               const Ipv4Header& header,
+                               Ptr<NetDevice> oif,
+                               Socket::SocketErrno& sockerr) override;
+    bool RouteInput(Ptr<const Packet> p,
+                    const Ipv4Header& header,
+                    Ptr<const NetDevice> idev,
+                    const UnicastForwardCallback& ucb,
+                    const MulticastForwardCallback& mcb,
+                    const LocalDeliverCallback& lcb,
+                    const ErrorCallback& ecb) override;
+    void NotifyInterfaceUp(uint32_t interface) override {}
+    void NotifyInterfaceDown(uint32_t interface) override {}
+    void NotifyAddAddress(uint32_t interface, Ipv4InterfaceAddress address) override {}
+    void NotifyRemoveAddress(uint32_t interface, Ipv4InterfaceAddress address) override {}
+    void SetIpv4(Ptr<Ipv4> ipv4) override { m_ipv4 = ipv4; }
+    void PrintRoutingTable(Ptr<OutputStreamWrapper> stream, Time::Unit unit = Time::S) const override;
+
+protected:
+    void DoDispose() override;
+
+private:
+    /**
+     * Build a route towards header's destination, or nullptr if the table has none.
+     */
+    Ptr<Ipv4Route> Lookup(const Ipv4Header& header, uint32_t flowHash) const;
+
+    /**
+     * Flow hash over addresses, protocol, ports and this satellite's ID.
+     */
+    uint32_t HashFlow(const Ipv4Header& header, uint16_t srcPort, uint16_t dstPort) const;
+
+    Ptr<Ipv4> m_ipv4;
+    uint32_t m_satId;
+    std::vector<IslPort> m_ports;
+    std::shared_ptr<const std::unordered_map<uint32_t, uint32_t>> m_addressToSat;
+    std::shared_ptr<const IslNextHopTable> m_table;
+    mutable uint64_t m_forwarded;
+};
+
+/**
+ * Installs IslTableRouting on all satellites and swaps their shared table.
+ */
+class IslTableRoutingHelper {
+public:
+    /**
+     * Add IslTableRouting (priority 10) to every satellite's Ipv4ListRouting
+     *
+     * @param satellites Satellite nodes (node ID = satellite ID)
+     * @param topology ISL topology (port order)
+     * @param creator Network creator after InstallStaticRoutes (link/interface map)
+     * @param table Initial next-hop table
+     */
+    void Install(NodeContainer satellites,
+                 const IslTopology& topology,
+                 const IslNetworkCreator& creator,
+                 std::shared_ptr<const IslNextHopTable> table);
+
+    /**
+     * Point every satellite at a new table
+     */
+    void SetTable(std::shared_ptr<const IslNextHopTable> table);
+
+    uint64_t GetForwardedPackets() const;
+
+private:
+    std::vector<Ptr<IslTableRouting>> m_protocols;
+};
+
+} // namespace ns3
+
+#endif // ISL_TABLE_ROUTING_H
@@ -18,20 +18,17 @@
 
 namespace ns3 {
 
-IslTopology GenerateWalkerDeltaTopology(uint32_t numSatellites, uint32_t neighborsPerSat) {
+IslTopology GenerateWalkerDeltaTopology(uint32_t numSatellites, uint32_t neighborsPerSat, uint32_t numPlanes) {
     IslTopology topology;
     topology.numSatellites = numSatellites;
 
-    // Walker-Delta 53:24/3/1: 3 planes, 8 satellites per plane
-    const uint32_t NUM_PLANES = 3;
-    const uint32_t SATS_PER_PLANE = 8;
-
-    // Validate input
-    if (numSatellites != 24) {
-        // For now, only support 24-satellite constellation
-        // Future: generalize to other Walker-Delta configurations
+    // Walker-Delta 53:24/3/1 by default: 3 planes, 8 satellites per plane
+    // (at least 3 planes and 3 satellites per plane, so all 4 neighbors are distinct)
+    if (numPlanes < 3 || numSatellites % numPlanes != 0 || numSatellites / numPlanes < 3) {
         return topology;
     }
+    const uint32_t NUM_PLANES = numPlanes;
+    const uint32_t SATS_PER_PLANE = numSatellites / numPlanes;
 
     if (neighborsPerSat != 4) {
         // Only 4-neighbor topology supported (industry standard)
@@ -93,6 +90,18 @@ IslTopology GenerateWalkerDeltaTopology(uint32_t numSatellites, uint32_t neighbo
 
     topology.numLinks = uniqueLinks.size();
 
+    // Link list in the order IslNetworkCreator creates them (ascending satellite,
+    // neighbor list order), so link i owns ISL devices 2i and 2i+1
+    std::set<std::pair<uint32_t, uint32_t>> listed;
+    for (uint32_t sat = 0; sat < numSatellites; ++sat) {
+        for (uint32_t neighbor : topology.neighbors[sat]) {
+            if (sat >= neighbor) continue;
+            if (listed.insert({sat, neighbor}).second) {
+                topology.links.push_back({sat, neighbor});
+            }
+        }
+    }
+
     return topology;
 }
 
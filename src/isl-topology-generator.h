@@ -17,6 +17,7 @@
 #include <vector>
 #include <map>
 #include <cstdint>
+#include <utility>
 
 namespace ns3 {
 
@@ -29,6 +30,7 @@ struct IslTopology {
     uint32_t numSatellites;                              // Total number of satellites
     uint32_t numLinks;                                    // Number of bidirectional ISL links
     std::map<uint32_t, std::vector<uint32_t>> neighbors; // satId → list of neighbor satIds
+    std::vector<std::pair<uint32_t, uint32_t>> links;    // Bidirectional links (a < b), in ISL creation order
 
     IslTopology() : numSatellites(0), numLinks(0) {}
 };
@@ -40,14 +42,18 @@ struct IslTopology {
  * 1. Intra-plane neighbors (2): Previous and next satellite in same orbital plane (ring topology)
  * 2. Inter-plane neighbors (2): Satellites in adjacent planes (fixed index or distance-based)
  *
+ * Satellite ID = plane × (numSatellites / numPlanes) + index in plane; neighbor
+ * list order is forward, backward, next plane, previous plane.
+ *
  * @param numSatellites Total number of satellites (24 for Walker-Delta 53:24/3/1)
  * @param neighborsPerSat Number of ISL neighbors per satellite (4 recommended)
- * @return ISL topology structure with neighbor relationships
+ * @param numPlanes Orbital planes (≥ 3, dividing numSatellites into ≥ 3 per plane)
+ * @return ISL topology structure with neighbor relationships (empty if unsupported)
  *
  * Complexity: O(V) where V = numSatellites
  * Memory: O(V × neighborsPerSat)
  */
-IslTopology GenerateWalkerDeltaTopology(uint32_t numSatellites, uint32_t neighborsPerSat);
+IslTopology GenerateWalkerDeltaTopology(uint32_t numSatellites, uint32_t neighborsPerSat, uint32_t numPlanes = 3);
 
 /**
  * Compute mesh connectivity (percentage of satellite pairs that can reach each other)
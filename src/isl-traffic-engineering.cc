@@ -0,0 +1,135 @@
+/**
+ * ISL Traffic Engineering Implementation
+ *
+ * The worker only reads a copy of the topology and the weight vector taken when it
+ * starts, and returns a fresh table; nothing is shared with the simulation thread.
+ */
+
+#include "isl-traffic-engineering.h"
+#include "ns3/point-to-point-net-device.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <chrono>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("IslTrafficEngineering");
+
+IslTrafficEngineering::IslTrafficEngineering()
+    : m_high(0.7),
+      m_low(0.4),
+      m_penalty(2.0),
+      m_recomputations(0),
+      m_swaps(0),
+      m_stateChanges(0),
+      m_peakCongested(0),
+      m_waitSeconds(0.0) {
+}
+
+IslTrafficEngineering::~IslTrafficEngineering() {
+    // Never leave a worker running past the owner
+    if (m_pending.valid()) {
+        m_pending.wait();
+    }
+}
+
+void IslTrafficEngineering::SetThresholds(double high, double low) {
+    NS_ASSERT_MSG(high > 0.0 && low >= 0.0 && low < high, "TE thresholds need 0 ≤ low < high");
+    m_high = high;
+    m_low = low;
+}
+
+void IslTrafficEngineering::Install(const IslTopology& topology,
+                                    const NetDeviceContainer& islDevices,
+                                    Time interval,
+                                    SwapCallback swap) {
+    NS_LOG_FUNCTION(this);
+
+    NS_ASSERT_MSG(islDevices.GetN() == topology.links.size() * 2,
+        "ISL device count " << islDevices.GetN() << " does not match " << topology.links.size() << " links");
+    NS_ASSERT_MSG(interval.IsStrictlyPositive(), "TE interval must be positive");
+
+    m_topology = topology;
+    m_swap = std::move(swap);
+    m_interval = interval;
+
+    const uint32_t dirs = islDevices.GetN();
+    m_txBytes.assign(dirs, 0);
+    m_lastTxBytes.assign(dirs, 0);
+    m_dataRateBps.assign(dirs, 0.0);
+    m_congested.assign(topology.links.size(), false);
+
+    for (uint32_t dir = 0; dir < dirs; ++dir) {
+        Ptr<PointToPointNetDevice> p2p = DynamicCast<PointToPointNetDevice>(islDevices.Get(dir));
+        NS_ASSERT_MSG(p2p, "ISL device " << dir << " is not a PointToPointNetDevice");
+
+        DataRateValue rate;
+        p2p->GetAttribute("DataRate", rate);
+        m_dataRateBps[dir] = static_cast<double>(rate.Get().GetBitRate());
+
+        p2p->TraceConnectWithoutContext("PhyTxEnd",
+            MakeBoundCallback(&IslTrafficEngineering::TxTrace, this, dir));
+    }
+
+    m_updateEvent = Simulator::Schedule(m_interval, &IslTrafficEngineering::Update, this);
+
+    NS_LOG_INFO("TE loop on " << topology.links.size() << " ISLs every " << m_interval.GetSeconds()
+        << "s (congested ≥ " << m_high << ", cleared ≤ " << m_low << ", penalty " << m_penalty << ")");
+}
+
+void IslTrafficEngineering::TxTrace(IslTrafficEngineering* te, uint32_t dir, Ptr<const Packet> packet) {
+    te->m_txBytes[dir] += packet->GetSize();
+}
+
+void IslTrafficEngineering::Update() {
+    NS_LOG_FUNCTION(this);
+
+    // Table computed during the last interval goes live now
+    if (m_pending.valid()) {
+        auto start = std::chrono::steady_clock::now();
+        IslNextHopTable table = m_pending.get();
+        m_waitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        m_swap(std::make_shared<const IslNextHopTable>(std::move(table)));
+        m_swaps++;
+    }
+
+    // Link utilisation over the interval (busier direction), Schmitt trigger per link
+    const double seconds = m_interval.GetSeconds();
+    bool changed = false;
+    uint32_t congested = 0;
+    for (uint32_t link = 0; link < m_congested.size(); ++link) {
+        double utilization = 0.0;
+        for (uint32_t dir = 2 * link; dir < 2 * link + 2; ++dir) {
+            double bits = 8.0 * (m_txBytes[dir] - m_lastTxBytes[dir]);
+            m_lastTxBytes[dir] = m_txBytes[dir];
+            if (m_dataRateBps[dir] > 0.0) {
+                utilization = std::max(utilization, bits / (m_dataRateBps[dir] * seconds));
+            }
+        }
+        bool state = m_congested[link] ? utilization > m_low : utilization >= m_high;
+        if (state != m_congested[link]) {
+            m_congested[link] = state;
+            m_stateChanges++;
+            changed = true;
+        }
+        congested += state ? 1 : 0;
+    }
+    m_peakCongested = std::max(m_peakCongested, congested);
+
+    // Recompute in the background; swapped in at the next update
+    if (changed) {
+        std::vector<double> weights(m_congested.size());
+        for (uint32_t link = 0; link < m_congested.size(); ++link) {
+            weights[link] = 1.0 + (m_congested[link] ? m_penalty : 0.0);
+        }
+        m_pending = std::async(std::launch::async, [topology = m_topology, weights = std::move(weights)]() {
+            return ComputeDelayWeightedRoutes(topology, weights);
+        });
+        m_recomputations++;
+        NS_LOG_INFO(Simulator::Now().GetSeconds() << "s: " << congested << " congested ISLs, recomputing routes");
+    }
+
+    m_updateEvent = Simulator::Schedule(m_interval, &IslTrafficEngineering::Update, this);
+}
+
+} // namespace ns3
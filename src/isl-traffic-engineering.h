@@ -0,0 +1,116 @@
+/**
+ * ISL Traffic Engineering
+ *
+ * Purpose: Load-aware re-weighting of the static ISL routes
+ * Features:
+ * - Per-link utilisation from PointToPointNetDevice PhyTxEnd bytes over each interval
+ *   (a link's load is its busier direction)
+ * - Hysteresis per link (Schmitt trigger): congested at utilisation ≥ high, cleared
+ *   only at ≤ low, so a link near one threshold does not flap
+ * - Link weight = 1 + penalty while congested; routes are recomputed only when a
+ *   link changes state (ComputeDelayWeightedRoutes over the weights)
+ * - Recomputation runs on a worker thread while the simulation continues; the new
+ *   table is swapped in one interval later (simulated time), waiting for the worker
+ *   if needed, so results do not depend on wall-clock speed
+ * - The table is handed to a swap callback (IslTableRoutingHelper / IslSourceRoutingHelper)
+ *
+ * Usage:
+ *   IslTrafficEngineering te;
+ *   te.SetThresholds(0.7, 0.4);
+ *   te.SetPenalty(2.0);
+ *   te.Install(topology, islDevices, Seconds(1.0),
+ *       [&](std::shared_ptr<const IslNextHopTable> t) { helper.SetTable(t); });
+ */
+
+#ifndef ISL_TRAFFIC_ENGINEERING_H
+#define ISL_TRAFFIC_ENGINEERING_H
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "isl-topology-generator.h"
+#include "static-isl-routing.h"
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace ns3 {
+
+class IslTrafficEngineering {
+public:
+    using SwapCallback = std::function<void(std::shared_ptr<const IslNextHopTable>)>;
+
+    IslTrafficEngineering();
+    ~IslTrafficEngineering();
+
+    /**
+     * @param high Utilisation (0..1] at which a link becomes congested
+     * @param low Utilisation below high at which it is cleared
+     */
+    void SetThresholds(double high, double low);
+
+    /**
+     * @param penalty Extra weight (in hops) of a congested link
+     */
+    void SetPenalty(double penalty) { m_penalty = penalty; }
+
+    /**
+     * Hook all ISL devices and start the periodic TE loop
+     *
+     * @param topology ISL topology (link i owns islDevices 2i and 2i+1)
+     * @param islDevices ISL devices (from IslNetworkCreator::CreateIslMesh)
+     * @param interval Measurement and swap interval
+     * @param swap Called with every recomputed table
+     */
+    void Install(const IslTopology& topology,
+                 const NetDeviceContainer& islDevices,
+                 Time interval,
+                 SwapCallback swap);
+
+    uint64_t GetRecomputations() const { return m_recomputations; }
+    uint64_t GetTableSwaps() const { return m_swaps; }
+    uint64_t GetStateChanges() const { return m_stateChanges; }
+    uint32_t GetPeakCongestedLinks() const { return m_peakCongested; }
+
+    /**
+     * Wall-clock time the simulation waited for the worker (s)
+     */
+    double GetWaitSeconds() const { return m_waitSeconds; }
+
+private:
+    static void TxTrace(IslTrafficEngineering* te, uint32_t dir, Ptr<const Packet> packet);
+
+    /**
+     * Measure, update link states, swap in the previous interval's table and start a
+     * new recomputation if any link changed state
+     */
+    void Update();
+
+    IslTopology m_topology;
+    SwapCallback m_swap;
+    Time m_interval;
+    double m_high;
+    double m_low;
+    double m_penalty;
+
+    // Per direction (index = 2 × link + dir)
+    std::vector<uint64_t> m_txBytes;
+    std::vector<uint64_t> m_lastTxBytes;
+    std::vector<double> m_dataRateBps;
+
+    // Per link
+    std::vector<bool> m_congested;
+
+    std::future<IslNextHopTable> m_pending;
+    EventId m_updateEvent;
+
+    uint64_t m_recomputations;
+    uint64_t m_swaps;
+    uint64_t m_stateChanges;
+    uint32_t m_peakCongested;
+    double m_waitSeconds;
+};
+
+} // namespace ns3
+
+#endif // ISL_TRAFFIC_ENGINEERING_H
@@ -0,0 +1,281 @@
+/**
+ * Lean UDP Traffic Implementation
+ *
+ * Packet(size) without data uses the Buffer zero area: the shared payload costs
+ * no byte storage, and copies only allocate when the header is added.
+ */
+
+#include "lean-udp-traffic.h"
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/log.h"
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("LeanUdpTraffic");
+
+NS_OBJECT_ENSURE_REGISTERED(LeanFlowHeader);
+NS_OBJECT_ENSURE_REGISTERED(LeanUdpSource);
+NS_OBJECT_ENSURE_REGISTERED(LeanUdpSink);
+
+// ============================================================================
+// LeanFlowHeader
+// ============================================================================
+
+TypeId LeanFlowHeader::GetTypeId() {
+    static TypeId tid = TypeId("ns3::LeanFlowHeader")
+        .SetParent<Header>()
+        .SetGroupName("Applications")
+        .AddConstructor<LeanFlowHeader>();
+    return tid;
+}
+
+TypeId LeanFlowHeader::GetInstanceTypeId() const {
+    return GetTypeId();
+}
+
+void LeanFlowHeader::Serialize(Buffer::Iterator start) const {
+    start.WriteHtonU32(m_flowId);
+    start.WriteHtonU32(m_seq);
+    start.WriteHtonU64(static_cast<uint64_t>(m_txTime));
+}
+
+uint32_t LeanFlowHeader::Deserialize(Buffer::Iterator start) {
+    m_flowId = start.ReadNtohU32();
+    m_seq = start.ReadNtohU32();
+    m_txTime = static_cast<int64_t>(start.ReadNtohU64());
+    return GetSerializedSize();
+}
+
+void LeanFlowHeader::Print(std::ostream& os) const {
+    os << "flow=" << m_flowId << " seq=" << m_seq << " tx=" << GetTxTime().As(Time::S);
+}
+
+// ============================================================================
+// LeanUdpSource
+// ============================================================================
+
+TypeId LeanUdpSource::GetTypeId() {
+    static TypeId tid = TypeId("ns3::LeanUdpSource")
+        .SetParent<Application>()
+        .SetGroupName("Applications")
+        .AddConstructor<LeanUdpSource>()
+        .AddAttribute("Remote", "Destination address and port",
+                      AddressValue(),
+                      MakeAddressAccessor(&LeanUdpSource::m_remote),
+                      MakeAddressChecker())
+        .AddAttribute("DataRate", "Mean sending rate",
+                      DataRateValue(DataRate("1Mbps")),
+                      MakeDataRateAccessor(&LeanUdpSource::m_rate),
+                      MakeDataRateChecker())
+        .AddAttribute("PacketSize", "UDP payload size in bytes (including the 16-byte flow header)",
+                      UintegerValue(512),
+                      MakeUintegerAccessor(&LeanUdpSource::m_packetSize),
+                      MakeUintegerChecker<uint32_t>(16))
+        .AddAttribute("BurstSize", "Packets sent per scheduled event",
+                      UintegerValue(1),
+                      MakeUintegerAccessor(&LeanUdpSource::m_burstSize),
+                      MakeUintegerChecker<uint32_t>(1))
+        .AddAttribute("Poisson", "Exponential inter-burst times instead of constant",
+                      BooleanValue(false),
+                      MakeBooleanAccessor(&LeanUdpSource::m_poisson),
+                      MakeBooleanChecker())
+        .AddAttribute("FlowId", "Flow ID written into every packet",
+                      UintegerValue(0),
+                      MakeUintegerAccessor(&LeanUdpSource::m_flowId),
+                      MakeUintegerChecker<uint32_t>())
+        .AddAttribute("MaxBytes", "Stop after this many payload bytes (0 = unlimited)",
+                      UintegerValue(0),
+                      MakeUintegerAccessor(&LeanUdpSource::m_maxBytes),
+                      MakeUintegerChecker<uint64_t>());
+    return tid;
+}
+
+LeanUdpSource::LeanUdpSource()
+    : m_packetSize(512),
+      m_burstSize(1),
+      m_poisson(false),
+      m_flowId(0),
+      m_maxBytes(0),
+      m_seq(0),
+      m_sentBytes(0) {
+    m_interval = CreateObject<ExponentialRandomVariable>();
+}
+
+int64_t LeanUdpSource::AssignStreams(int64_t stream) {
+    m_interval->SetStream(stream);
+    return 1;
+}
+
+void LeanUdpSource::DoDispose() {
+    m_socket = nullptr;
+    m_payload = nullptr;
+    Application::DoDispose();
+}
+
+void LeanUdpSource::StartApplication() {
+    NS_LOG_FUNCTION(this);
+
+    if (!m_socket) {
+        m_socket = Socket::CreateSocket(GetNode(), UdpSocketFactory::GetTypeId());
+        m_socket->Bind();
+        m_socket->Connect(m_remote);
+        m_socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+    }
+
+    LeanFlowHeader header;
+    m_payload = Create<Packet>(m_packetSize - header.GetSerializedSize());
+
+    m_sendEvent = Simulator::ScheduleNow(&LeanUdpSource::SendBurst, this);
+}
+
+void LeanUdpSource::StopApplication() {
+    NS_LOG_FUNCTION(this);
+    Simulator::Cancel(m_sendEvent);
+    if (m_socket) {
+        m_socket->Close();
+        m_socket = nullptr;
+    }
+}
+
+void LeanUdpSource::SendBurst() {
+    for (uint32_t i = 0; i < m_burstSize; ++i) {
+        if (m_maxBytes > 0 && m_sentBytes >= m_maxBytes) {
+            StopApplication();
+            return;
+        }
+
+        LeanFlowHeader header;
+        header.SetFlowId(m_flowId);
+        header.SetSeq(m_seq);
+        header.SetTxTime(Simulator::Now());
+
+        Ptr<Packet> packet = m_payload->Copy();
+        packet->AddHeader(header);
+        if (m_socket->Send(packet) >= 0) {
+            m_sentBytes += m_packetSize;
+        }
+        m_seq++;  // Lost at the socket counts as lost at the sink
+    }
+
+    // Mean rate is preserved: one event per BurstSize packet intervals
+    double burstSeconds = static_cast<double>(m_packetSize) * 8.0 * m_burstSize / m_rate.GetBitRate();
+    Time next = Seconds(m_poisson ? m_interval->GetValue(burstSeconds, 0.0) : burstSeconds);
+    m_sendEvent = Simulator::Schedule(next, &LeanUdpSource::SendBurst, this);
+}
+
+// ============================================================================
+// LeanUdpSink
+// ============================================================================
+
+TypeId LeanUdpSink::GetTypeId() {
+    static TypeId tid = TypeId("ns3::LeanUdpSink")
+        .SetParent<Application>()
+        .SetGroupName("Applications")
+        .AddConstructor<LeanUdpSink>()
+        .AddAttribute("Port", "Local UDP port",
+                      UintegerValue(9),
+                      MakeUintegerAccessor(&LeanUdpSink::m_port),
+                      MakeUintegerChecker<uint16_t>());
+    return tid;
+}
+
+LeanUdpSink::LeanUdpSink()
+    : m_port(9),
+      m_rxPackets(0),
+      m_rxBytes(0),
+      m_reordered(0),
+      m_duplicates(0) {
+}
+
+void LeanUdpSink::DoDispose() {
+    m_socket = nullptr;
+    Application::DoDispose();
+}
+
+void LeanUdpSink::StartApplication() {
+    NS_LOG_FUNCTION(this);
+    if (!m_socket) {
+        m_socket = Socket::CreateSocket(GetNode(), UdpSocketFactory::GetTypeId());
+        m_socket->Bind(InetSocketAddress(Ipv4Address::GetAny(), m_port));
+        m_socket->SetRecvCallback(MakeCallback(&LeanUdpSink::HandleRead, this));
+    }
+}
+
+void LeanUdpSink::StopApplication() {
+    if (m_socket) {
+        m_socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+        m_socket->Close();
+    }
+}
+
+void LeanUdpSink::HandleRead(Ptr<Socket> socket) {
+    Ptr<Packet> packet;
+    Address from;
+    while ((packet = socket->RecvFrom(from))) {
+        m_rxPackets++;
+        m_rxBytes += packet->GetSize();
+
+        LeanFlowHeader header;
+        if (packet->GetSize() < header.GetSerializedSize()) continue;
+        packet->PeekHeader(header);
+        m_delaySum += Simulator::Now() - header.GetTxTime();
+
+        FlowState& flow = m_flows[header.GetFlowId()];
+        const uint32_t seq = header.GetSeq();
+        if (seq >= flow.seen.size()) {
+            flow.seen.resize(std::max<size_t>(seq + 1, 2 * flow.seen.size()), false);
+        }
+        if (flow.seen[seq]) {
+            m_duplicates++;
+            continue;
+        }
+        flow.seen[seq] = true;
+        flow.distinct++;
+        if (seq >= flow.nextSeq) {
+            flow.nextSeq = seq + 1;
+        } else {
+            m_reordered++;  // Arrived after a later packet (fills an earlier gap)
+        }
+    }
+}
+
+uint64_t LeanUdpSink::GetLostPackets(uint32_t flowId, uint32_t sent) const {
+    auto it = m_flows.find(flowId);
+    uint64_t distinct = (it == m_flows.end()) ? 0 : it->second.distinct;
+    return sent > distinct ? sent - distinct : 0;
+}
+
+// ============================================================================
+// LeanUdpHelper
+// ============================================================================
+
+LeanUdpHelper::LeanUdpHelper()
+    : m_rate("1Mbps"),
+      m_packetSize(512),
+      m_burstSize(1),
+      m_poisson(false) {
+}
+
+ApplicationContainer LeanUdpHelper::InstallSource(Ptr<Node> node, const Address& remote, uint32_t flowId) const {
+    Ptr<LeanUdpSource> source = CreateObject<LeanUdpSource>();
+    source->SetAttribute("Remote", AddressValue(remote));
+    source->SetAttribute("DataRate", DataRateValue(m_rate));
+    source->SetAttribute("PacketSize", UintegerValue(m_packetSize));
+    source->SetAttribute("BurstSize", UintegerValue(m_burstSize));
+    source->SetAttribute("Poisson", BooleanValue(m_poisson));
+    source->SetAttribute("FlowId", UintegerValue(flowId));
+    node->AddApplication(source);
+    return ApplicationContainer(source);
+}
+
+ApplicationContainer LeanUdpHelper::InstallSink(Ptr<Node> node, uint16_t port) const {
+    Ptr<LeanUdpSink> sink = CreateObject<LeanUdpSink>();
+    sink->SetAttribute("Port", UintegerValue(port));
+    node->AddApplication(sink);
+    return ApplicationContainer(sink);
+}
+
+} // namespace ns3
@@ -0,0 +1,179 @@
+/**
+ * Lean UDP Traffic
+ *
+ * Purpose: Low-overhead CBR/Poisson UDP source and counting sink for test flows
+ * Features:
+ * - One zero-filled payload per source, created once; every send is a
+ *   copy-on-write Packet::Copy() of it plus a 16-byte LeanFlowHeader
+ * - LeanFlowHeader carries flow ID, sequence number and send time, so the sink
+ *   counts loss (sequences never received, against the source's sent count),
+ *   duplicates, reordering and one-way delay without FlowMonitor
+ * - Optional bursts: BurstSize packets per scheduled event (same mean rate,
+ *   BurstSize× fewer simulator events)
+ * - CBR (fixed interval) or Poisson (exponential interval) event times
+ * - "MaxBytes" stops the source once reached (same attribute name as OnOff)
+ *
+ * Usage:
+ *   LeanUdpHelper lean;
+ *   lean.SetRate(DataRate("10Mbps"));
+ *   ApplicationContainer src = lean.InstallSource(node, InetSocketAddress(dst, port), flowId);
+ *   ApplicationContainer sink = lean.InstallSink(dstNode, port);
+ */
+
+#ifndef LEAN_UDP_TRAFFIC_H
+#define LEAN_UDP_TRAFFIC_H
+
+#include "ns3/application.h"
+#include "ns3/application-container.h"
+#include "ns3/address.h"
+#include "ns3/data-rate.h"
+#include "ns3/event-id.h"
+#include "ns3/header.h"
+#include "ns3/node.h"
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/socket.h"
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * Per-packet flow header (16 bytes, network byte order)
+ */
+class LeanFlowHeader : public Header {
+public:
+    static TypeId GetTypeId();
+    TypeId GetInstanceTypeId() const override;
+
+    LeanFlowHeader() : m_flowId(0), m_seq(0), m_txTime(0) {}
+
+    void SetFlowId(uint32_t flowId) { m_flowId = flowId; }
+    void SetSeq(uint32_t seq) { m_seq = seq; }
+    void SetTxTime(Time t) { m_txTime = t.GetTimeStep(); }
+    uint32_t GetFlowId() const { return m_flowId; }
+    uint32_t GetSeq() const { return m_seq; }
+    Time GetTxTime() const { return TimeStep(m_txTime); }
+
+    uint32_t GetSerializedSize() const override { return 16; }
+    void Serialize(Buffer::Iterator start) const override;
+    uint32_t Deserialize(Buffer::Iterator start) override;
+    void Print(std::ostream& os) const override;
+
+private:
+    uint32_t m_flowId;
+    uint32_t m_seq;
+    int64_t m_txTime;  // Time steps
+};
+
+class LeanUdpSource : public Application {
+public:
+    static TypeId GetTypeId();
+
+    LeanUdpSource();
+    ~LeanUdpSource() override = default;
+
+    uint32_t GetSentPackets() const { return m_seq; }
+    uint32_t GetFlowId() const { return m_flowId; }
+
+    int64_t AssignStreams(int64_t stream) override;
+
+protected:
+    void DoDispose() override;
+
+private:
+    void StartApplication() override;
+    void StopApplication() override;
+
+    /**
+     * Send one burst and schedule the next.
+     */
+    void SendBurst();
+
+    Address m_remote;
+    DataRate m_rate;
+    uint32_t m_packetSize;   // UDP payload bytes, header included
+    uint32_t m_burstSize;
+    bool m_poisson;
+    uint32_t m_flowId;
+    uint64_t m_maxBytes;     // 0 = unlimited
+
+    Ptr<Socket> m_socket;
+    Ptr<Packet> m_payload;   // Shared zero-filled payload (packet size − header)
+    Ptr<ExponentialRandomVariable> m_interval;
+    EventId m_sendEvent;
+    uint32_t m_seq;
+    uint64_t m_sentBytes;
+};
+
+class LeanUdpSink : public Application {
+public:
+    static TypeId GetTypeId();
+
+    LeanUdpSink();
+    ~LeanUdpSink() override = default;
+
+    uint64_t GetReceivedPackets() const { return m_rxPackets; }
+    uint64_t GetReceivedBytes() const { return m_rxBytes; }
+    uint64_t GetReorderedPackets() const { return m_reordered; }
+    uint64_t GetDuplicatePackets() const { return m_duplicates; }
+    Time GetDelaySum() const { return m_delaySum; }
+
+    /**
+     * Packets of a flow never received (duplicates do not fill a gap; packets
+     * after the highest sequence received count too)
+     *
+     * @param flowId Flow ID carried in LeanFlowHeader
+     * @param sent Packets the source sent (LeanUdpSource::GetSentPackets)
+     */
+    uint64_t GetLostPackets(uint32_t flowId, uint32_t sent) const;
+
+protected:
+    void DoDispose() override;
+
+private:
+    void StartApplication() override;
+    void StopApplication() override;
+    void HandleRead(Ptr<Socket> socket);
+
+    struct FlowState {
+        uint32_t nextSeq;        // Highest sequence seen + 1
+        uint64_t distinct;       // Distinct sequences seen
+        std::vector<bool> seen;  // Indexed by sequence
+    };
+
+    uint16_t m_port;
+    Ptr<Socket> m_socket;
+    std::unordered_map<uint32_t, FlowState> m_flows;
+    uint64_t m_rxPackets;
+    uint64_t m_rxBytes;
+    uint64_t m_reordered;
+    uint64_t m_duplicates;
+    Time m_delaySum;
+};
+
+/**
+ * Installs LeanUdpSource / LeanUdpSink with shared settings.
+ */
+class LeanUdpHelper {
+public:
+    LeanUdpHelper();
+
+    void SetRate(DataRate rate) { m_rate = rate; }
+    void SetPacketSize(uint32_t bytes) { m_packetSize = bytes; }
+    void SetBurstSize(uint32_t packets) { m_burstSize = packets; }
+    void SetPoisson(bool poisson) { m_poisson = poisson; }
+
+    ApplicationContainer InstallSource(Ptr<Node> node, const Address& remote, uint32_t flowId) const;
+    ApplicationContainer InstallSink(Ptr<Node> node, uint16_t port) const;
+
+private:
+    DataRate m_rate;
+    uint32_t m_packetSize;
+    uint32_t m_burstSize;
+    bool m_poisson;
+};
+
+} // namespace ns3
+
+#endif // LEAN_UDP_TRAFFIC_H
@@ -0,0 +1,208 @@
+/**
+ * Manhattan Grid Mobility Model Implementation
+ *
+ * Intersections are (i × BlockSize, j × BlockSize) for i, j ∈ [0, Blocks], matching
+ * ManhattanGridHelper. A segment is one block; the event at its end (after the pause)
+ * draws the next heading, so a node never holds more than one pending event.
+ */
+
+#include "manhattan-grid-mobility-model.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("ManhattanGridMobilityModel");
+
+NS_OBJECT_ENSURE_REGISTERED(ManhattanGridMobilityModel);
+
+namespace {
+// Unit steps per heading (EAST, NORTH, WEST, SOUTH)
+const int DX[4] = {1, 0, -1, 0};
+const int DY[4] = {0, 1, 0, -1};
+}
+
+TypeId ManhattanGridMobilityModel::GetTypeId() {
+    static TypeId tid = TypeId("ns3::ManhattanGridMobilityModel")
+        .SetParent<MobilityModel>()
+        .SetGroupName("Mobility")
+        .AddConstructor<ManhattanGridMobilityModel>()
+        .AddAttribute("Blocks", "Blocks per dimension (Blocks+1 streets each way)",
+                      UintegerValue(5),
+                      MakeUintegerAccessor(&ManhattanGridMobilityModel::m_blocks),
+                      MakeUintegerChecker<uint32_t>())
+        .AddAttribute("BlockSize", "Block width (m)",
+                      DoubleValue(100.0),
+                      MakeDoubleAccessor(&ManhattanGridMobilityModel::m_blockSize),
+                      MakeDoubleChecker<double>(0.0))
+        .AddAttribute("Speed", "Travel speed (m/s)",
+                      DoubleValue(1.4),
+                      MakeDoubleAccessor(&ManhattanGridMobilityModel::m_speed),
+                      MakeDoubleChecker<double>(0.0))
+        .AddAttribute("Pause", "Stop time at every intersection",
+                      TimeValue(Seconds(0)),
+                      MakeTimeAccessor(&ManhattanGridMobilityModel::m_pause),
+                      MakeTimeChecker())
+        .AddAttribute("StartTime", "Nodes stay at their start intersection until this time",
+                      TimeValue(Seconds(0)),
+                      MakeTimeAccessor(&ManhattanGridMobilityModel::m_startTime),
+                      MakeTimeChecker())
+        .AddAttribute("TurnProbability", "Probability of turning (left or right, equally) at an intersection",
+                      DoubleValue(0.5),
+                      MakeDoubleAccessor(&ManhattanGridMobilityModel::m_turnProbability),
+                      MakeDoubleChecker<double>(0.0, 1.0));
+    return tid;
+}
+
+ManhattanGridMobilityModel::ManhattanGridMobilityModel()
+    : m_blocks(5),
+      m_blockSize(100.0),
+      m_speed(1.4),
+      m_turnProbability(0.5),
+      m_x(0),
+      m_y(0),
+      m_heading(STOPPED),
+      m_lastHeading(STOPPED),
+      m_z(0.0),
+      m_segments(0) {
+    m_rng = CreateObject<UniformRandomVariable>();
+}
+
+void ManhattanGridMobilityModel::DoInitialize() {
+    Simulator::Cancel(m_event);
+    Time delay = std::max(m_startTime - Simulator::Now(), Time(0));
+    m_event = Simulator::Schedule(delay, &ManhattanGridMobilityModel::NextSegment, this);
+    MobilityModel::DoInitialize();
+}
+
+void ManhattanGridMobilityModel::DoDispose() {
+    Simulator::Cancel(m_event);
+    m_rng = nullptr;
+    MobilityModel::DoDispose();
+}
+
+int64_t ManhattanGridMobilityModel::DoAssignStreams(int64_t stream) {
+    m_rng->SetStream(stream);
+    return 1;
+}
+
+Vector ManhattanGridMobilityModel::IntersectionPosition(uint32_t x, uint32_t y) const {
+    return Vector(x * m_blockSize, y * m_blockSize, m_z);
+}
+
+bool ManhattanGridMobilityModel::CanMove(Heading heading) const {
+    int64_t x = static_cast<int64_t>(m_x) + DX[heading];
+    int64_t y = static_cast<int64_t>(m_y) + DY[heading];
+    return x >= 0 && y >= 0 && x <= m_blocks && y <= m_blocks;
+}
+
+ManhattanGridMobilityModel::Heading ManhattanGridMobilityModel::ChooseHeading() {
+    if (m_blocks == 0 || m_speed <= 0.0) {
+        return STOPPED;
+    }
+
+    if (m_lastHeading == STOPPED) {
+        // First block: any direction that stays on the grid
+        Heading valid[4];
+        uint32_t n = 0;
+        for (int h = EAST; h <= SOUTH; ++h) {
+            if (CanMove(static_cast<Heading>(h))) valid[n++] = static_cast<Heading>(h);
+        }
+        return valid[m_rng->GetInteger(0, n - 1)];
+    }
+
+    const Heading straight = m_lastHeading;
+    const Heading left = static_cast<Heading>((m_lastHeading + 1) % 4);
+    const Heading right = static_cast<Heading>((m_lastHeading + 3) % 4);
+    const Heading back = static_cast<Heading>((m_lastHeading + 2) % 4);
+
+    double wStraight = CanMove(straight) ? 1.0 - m_turnProbability : 0.0;
+    double wLeft = CanMove(left) ? m_turnProbability / 2.0 : 0.0;
+    double wRight = CanMove(right) ? m_turnProbability / 2.0 : 0.0;
+    if (wStraight + wLeft + wRight <= 0.0) {
+        // Edge of the grid with straight ahead blocked (or TurnProbability 0): must turn
+        wLeft = CanMove(left) ? 1.0 : 0.0;
+        wRight = CanMove(right) ? 1.0 : 0.0;
+        if (wLeft + wRight <= 0.0) {
+            return back;  // Dead end (1-block-wide grid)
+        }
+    }
+
+    double u = m_rng->GetValue(0.0, wStraight + wLeft + wRight);
+    if (u < wStraight) return straight;
+    if (u < wStraight + wLeft) return left;
+    return right;
+}
+
+void ManhattanGridMobilityModel::NextSegment() {
+    // Arrive at the end of the current block
+    if (m_heading != STOPPED) {
+        m_x += DX[m_heading];
+        m_y += DY[m_heading];
+        m_lastHeading = m_heading;
+    }
+
+    m_heading = ChooseHeading();
+    m_departure = Simulator::Now();
+    NotifyCourseChange();
+    if (m_heading == STOPPED) {
+        return;
+    }
+
+    m_segments++;
+    Time travel = Seconds(m_blockSize / m_speed);
+    if (m_pause.IsStrictlyPositive()) {
+        m_event = Simulator::Schedule(travel, &ManhattanGridMobilityModel::Arrive, this);
+    } else {
+        m_event = Simulator::Schedule(travel, &ManhattanGridMobilityModel::NextSegment, this);
+    }
+}
+
+void ManhattanGridMobilityModel::Arrive() {
+    // Position and velocity already read as paused (travelled distance is capped at one block)
+    NotifyCourseChange();
+    m_event = Simulator::Schedule(m_pause, &ManhattanGridMobilityModel::NextSegment, this);
+}
+
+Vector ManhattanGridMobilityModel::DoGetPosition() const {
+    Vector position = IntersectionPosition(m_x, m_y);
+    if (m_heading == STOPPED) {
+        return position;
+    }
+    double travelled = std::min(m_speed * (Simulator::Now() - m_departure).GetSeconds(), m_blockSize);
+    position.x += DX[m_heading] * travelled;
+    position.y += DY[m_heading] * travelled;
+    return position;
+}
+
+void ManhattanGridMobilityModel::DoSetPosition(const Vector& position) {
+    // Snap to the nearest intersection and wait there until StartTime (or restart now)
+    auto snap = [this](double v) {
+        double i = std::round(v / m_blockSize);
+        return static_cast<uint32_t>(std::clamp(i, 0.0, static_cast<double>(m_blocks)));
+    };
+    m_x = m_blockSize > 0.0 ? snap(position.x) : 0;
+    m_y = m_blockSize > 0.0 ? snap(position.y) : 0;
+    m_z = position.z;
+    m_heading = STOPPED;
+    m_lastHeading = STOPPED;
+
+    Simulator::Cancel(m_event);
+    Time delay = std::max(m_startTime - Simulator::Now(), Time(0));
+    m_event = Simulator::Schedule(delay, &ManhattanGridMobilityModel::NextSegment, this);
+    NotifyCourseChange();
+}
+
+Vector ManhattanGridMobilityModel::DoGetVelocity() const {
+    Time elapsed = Simulator::Now() - m_departure;
+    if (m_heading == STOPPED || elapsed >= Seconds(m_blockSize / m_speed)) {
+        return Vector(0.0, 0.0, 0.0);  // Waiting to start, or paused at the intersection
+    }
+    return Vector(DX[m_heading] * m_speed, DY[m_heading] * m_speed, 0.0);
+}
+
+} // namespace ns3
@@ -0,0 +1,97 @@
+/**
+ * Manhattan Grid Mobility Model
+ *
+ * Purpose: Street-constrained mobility on a ManhattanGridHelper grid, generated on the fly
+ * Features:
+ * - Nodes move one block at a time along streets (no diagonal movement)
+ * - Position is computed analytically from the current segment (start intersection,
+ *   direction, start time), so memory per node is constant
+ * - The next segment is drawn only when the current one ends (one pending event per
+ *   node), so long runs stay mobile without pre-scheduled waypoints
+ * - At each intersection: straight ahead with probability 1 − TurnProbability, left or
+ *   right otherwise; directions leaving the grid are excluded (U-turn only at dead ends)
+ * - Optional pause at every intersection (course change notified on arrival, so
+ *   listeners see the stop); movement starts at StartTime
+ *
+ * Usage:
+ *   mobility.SetPositionAllocator(intersections);  // e.g. ManhattanGridHelper::GetRandomIntersection()
+ *   mobility.SetMobilityModel("ns3::ManhattanGridMobilityModel",
+ *                             "Blocks", UintegerValue(5), "BlockSize", DoubleValue(100.0),
+ *                             "Speed", DoubleValue(1.4), "StartTime", TimeValue(Seconds(20)));
+ */
+
+#ifndef MANHATTAN_GRID_MOBILITY_MODEL_H
+#define MANHATTAN_GRID_MOBILITY_MODEL_H
+
+#include "ns3/mobility-model.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+
+namespace ns3 {
+
+class ManhattanGridMobilityModel : public MobilityModel {
+public:
+    static TypeId GetTypeId();
+
+    ManhattanGridMobilityModel();
+    ~ManhattanGridMobilityModel() override = default;
+
+    /**
+     * Blocks travelled since the start (for diagnostics)
+     */
+    uint64_t GetSegments() const { return m_segments; }
+
+private:
+    enum Heading { EAST = 0, NORTH, WEST, SOUTH, STOPPED };
+
+    void DoInitialize() override;
+    void DoDispose() override;
+    Vector DoGetPosition() const override;
+    void DoSetPosition(const Vector& position) override;
+    Vector DoGetVelocity() const override;
+    int64_t DoAssignStreams(int64_t stream) override;
+
+    /**
+     * Arrived at the end of the block with a pause ahead: velocity drops to zero
+     * (course change), the next block starts after Pause
+     */
+    void Arrive();
+
+    /**
+     * Arrived at (or paused at) the current target intersection: start the next block
+     */
+    void NextSegment();
+
+    /**
+     * Choose the heading at intersection (m_x, m_y) given the current heading
+     */
+    Heading ChooseHeading();
+
+    bool CanMove(Heading heading) const;
+    Vector IntersectionPosition(uint32_t x, uint32_t y) const;
+
+    // Attributes
+    uint32_t m_blocks;
+    double m_blockSize;
+    double m_speed;
+    Time m_pause;
+    Time m_startTime;
+    double m_turnProbability;
+
+    // Current segment: from intersection (m_x, m_y) along m_heading, leaving at m_departure
+    uint32_t m_x;
+    uint32_t m_y;
+    Heading m_heading;
+    Heading m_lastHeading;   // Heading of the previous block (for straight/turn choice)
+    Time m_departure;
+    double m_z;
+    uint64_t m_segments;
+
+    Ptr<UniformRandomVariable> m_rng;
+    EventId m_event;
+};
+
+} // namespace ns3
+
+#endif // MANHATTAN_GRID_MOBILITY_MODEL_H
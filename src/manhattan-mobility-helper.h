@@ -77,11 +77,25 @@ public:
         }
 
         // Use NS-3 RNG for consistency with simulation
-        Ptr<UniformRandomVariable> rand = CreateObject<UniformRandomVariable>();
+        Ptr<UniformRandomVariable> rand = m_rand ? m_rand : CreateObject<UniformRandomVariable>();
         uint32_t idx = rand->GetInteger(0, m_intersections.size() - 1);
         return m_intersections[idx];
     }
 
+    /**
+     * Draw all further intersections from one fixed RNG stream.
+     *
+     * Without this, every call creates a variable on the next automatic stream.
+     *
+     * @param stream Stream number
+     * @return Number of streams used (1)
+     */
+    int64_t AssignStreams(int64_t stream) {
+        m_rand = CreateObject<UniformRandomVariable>();
+        m_rand->SetStream(stream);
+        return 1;
+    }
+
     /**
      * Check if position is aligned to grid.
      *
@@ -164,6 +178,7 @@ private:
     double m_blockSize;              // Block width in meters
     double m_areaBounds;             // Total area bounds
     std::vector<Vector> m_intersections;  // Pre-computed intersection positions
+    Ptr<UniformRandomVariable> m_rand;    // Fixed-stream RNG (null = automatic streams)
 };
 
 } // namespace ns3
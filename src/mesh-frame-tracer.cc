@@ -0,0 +1,127 @@
+/**
+ * MeshFrameTracer Implementation
+ */
+
+#include "mesh-frame-tracer.h"
+#include "ns3/dot11s-mac-header.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/llc-snap-header.h"
+#include "ns3/mesh-point-device.h"
+#include "ns3/mgt-action-headers.h"
+#include "ns3/udp-header.h"
+#include "ns3/wifi-information-element.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-mac-trailer.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-phy.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("MeshFrameTracer");
+
+namespace {
+const uint16_t ETHERTYPE_IPV4 = 0x0800;
+const uint8_t IP_PROTOCOL_UDP = 17;
+const uint16_t DATA_PORT_MIN = 9;   // Application ports, as PacketTracer
+const uint16_t DATA_PORT_MAX = 14;
+}
+
+MeshFrameTracer::MeshFrameTracer() {
+    Reset();
+}
+
+void MeshFrameTracer::Install(NetDeviceContainer devices) {
+    for (uint32_t i = 0; i < devices.GetN(); ++i) {
+        Ptr<MeshPointDevice> mp = DynamicCast<MeshPointDevice>(devices.Get(i));
+        if (!mp) {
+            NS_LOG_WARN("Device " << i << " is not a mesh point device, not traced");
+            continue;
+        }
+        for (Ptr<NetDevice> iface : mp->GetInterfaces()) {
+            Ptr<WifiNetDevice> wifi = DynamicCast<WifiNetDevice>(iface);
+            if (wifi) {
+                wifi->GetPhy()->TraceConnectWithoutContext(
+                    "PhyTxBegin", MakeCallback(&MeshFrameTracer::PhyTxBegin, this));
+            }
+        }
+    }
+}
+
+uint64_t MeshFrameTracer::GetControlBytesTx() const {
+    return m_bytes[PREQ] + m_bytes[PREP] + m_bytes[PERR] + m_bytes[RANN] + m_bytes[BEACON] + m_bytes[PEERING];
+}
+
+std::string MeshFrameTracer::GetTypeName(FrameType type) {
+    switch (type) {
+    case PREQ: return "preq";
+    case PREP: return "prep";
+    case PERR: return "perr";
+    case RANN: return "rann";
+    case BEACON: return "beacon";
+    case PEERING: return "peering";
+    case DATA: return "data";
+    default: return "other";
+    }
+}
+
+void MeshFrameTracer::Reset() {
+    m_frames.fill(0);
+    m_bytes.fill(0);
+}
+
+void MeshFrameTracer::PhyTxBegin(Ptr<const Packet> packet, double txPowerW) {
+    Ptr<Packet> copy = packet->Copy();
+    WifiMacHeader hdr;
+    copy->RemoveHeader(hdr);
+    if (hdr.IsCtl() || hdr.IsRetry()) {
+        return;  // ACK/RTS/CTS and retransmissions
+    }
+    WifiMacTrailer fcs;
+    copy->RemoveTrailer(fcs);
+
+    FrameType type = OTHER;
+    uint32_t bytes = copy->GetSize();  // Frame body
+    if (hdr.IsBeacon()) {
+        type = BEACON;
+    } else if (hdr.IsAction()) {
+        WifiActionHeader action;
+        copy->RemoveHeader(action);
+        if (action.GetCategory() == WifiActionHeader::SELF_PROTECTED) {
+            type = PEERING;
+        } else if (action.GetCategory() == WifiActionHeader::MESH && copy->GetSize() > 0) {
+            // Path selection frames carry their element first
+            uint8_t elementId = 0;
+            copy->CopyData(&elementId, 1);
+            if (elementId == IE_PREQ) {
+                type = PREQ;
+            } else if (elementId == IE_PREP) {
+                type = PREP;
+            } else if (elementId == IE_PERR) {
+                type = PERR;
+            } else if (elementId == IE_RANN) {
+                type = RANN;
+            }
+        }
+    } else if (hdr.IsData()) {
+        dot11s::MeshHeader meshHdr;
+        LlcSnapHeader llc;
+        copy->RemoveHeader(meshHdr);
+        copy->RemoveHeader(llc);
+        bytes = copy->GetSize();
+        if (llc.GetType() == ETHERTYPE_IPV4) {
+            Ipv4Header ip;
+            copy->RemoveHeader(ip);
+            bytes = ip.GetSerializedSize() + ip.GetPayloadSize();
+            UdpHeader udp;
+            if (ip.GetProtocol() == IP_PROTOCOL_UDP && copy->PeekHeader(udp) > 0 &&
+                udp.GetDestinationPort() >= DATA_PORT_MIN && udp.GetDestinationPort() <= DATA_PORT_MAX) {
+                type = DATA;
+            }
+        }
+    }
+
+    m_frames[type]++;
+    m_bytes[type] += bytes;
+}
+
+} // namespace ns3
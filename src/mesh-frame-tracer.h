@@ -0,0 +1,75 @@
+/**
+ * MeshFrameTracer - Layer-2 Frame Classification for 802.11s Meshes
+ *
+ * Counterpart of PacketTracer for HWMP, whose routing traffic never reaches IP.
+ * Hooks the PHY of every mesh interface and classifies each transmitted frame:
+ * - PREQ / PREP / PERR / RANN: mesh action frames (path selection), by element ID
+ * - Beacon: mesh beacons (neighbour discovery, needed for peering)
+ * - Peering: self-protected action frames (peer link open/confirm/close)
+ * - Data: mesh data frames carrying application UDP (dest port ∈ [9, 14], as PacketTracer)
+ * - Other: any other data/management frame (ARP, ...). ACK/RTS/CTS are not counted
+ *
+ * Bytes are counted comparably to the IP-layer tracer: control frames by frame body,
+ * data frames by the IP packet they carry; MAC header, mesh header, LLC and FCS are
+ * excluded. Retransmissions (Retry bit) are not counted; every hop's first
+ * transmission is, as IP forwarding would.
+ *
+ * Control bytes (for NRL) = PREQ + PREP + PERR + RANN + beacon + peering.
+ *
+ * Usage:
+ *   MeshFrameTracer frames;
+ *   frames.Install(meshDevices);  // MeshPointDevice container
+ *   ...
+ *   double nrl = (double)frames.GetControlBytesTx() / frames.GetDataBytesTx();
+ */
+
+#ifndef MESH_FRAME_TRACER_H
+#define MESH_FRAME_TRACER_H
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include <array>
+#include <string>
+
+namespace ns3 {
+
+class MeshFrameTracer {
+public:
+    enum FrameType { PREQ, PREP, PERR, RANN, BEACON, PEERING, DATA, OTHER, NUM_FRAME_TYPES };
+
+    MeshFrameTracer();
+
+    /**
+     * Hook the PHY of every interface of the mesh point devices
+     *
+     * @param devices MeshPointDevices (other device types are ignored)
+     */
+    void Install(NetDeviceContainer devices);
+
+    /**
+     * Routing control bytes transmitted (PREQ/PREP/PERR/RANN, beacons, peering)
+     */
+    uint64_t GetControlBytesTx() const;
+
+    /**
+     * Application data bytes transmitted (IP packet size, per hop)
+     */
+    uint64_t GetDataBytesTx() const { return m_bytes[DATA]; }
+
+    uint64_t GetBytes(FrameType type) const { return m_bytes[type]; }
+    uint64_t GetFrames(FrameType type) const { return m_frames[type]; }
+
+    static std::string GetTypeName(FrameType type);
+
+    void Reset();
+
+private:
+    void PhyTxBegin(Ptr<const Packet> packet, double txPowerW);
+
+    std::array<uint64_t, NUM_FRAME_TYPES> m_frames;
+    std::array<uint64_t, NUM_FRAME_TYPES> m_bytes;
+};
+
+} // namespace ns3
+
+#endif // MESH_FRAME_TRACER_H
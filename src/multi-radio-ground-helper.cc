@@ -0,0 +1,252 @@
+/**
+ * Multi-Radio Ground Helper Implementation
+ *
+ * With one radio the helper installs exactly what the single-radio ground network
+ * installs (same device order, same channel object), so results are unchanged.
+ */
+
+#include "multi-radio-ground-helper.h"
+#include "ns3/internet-module.h"
+#include "ns3/mobility-model.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <tuple>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("MultiRadioGroundHelper");
+
+namespace {
+const uint32_t UNASSIGNED = UINT32_MAX;
+
+double Distance2d(const Vector& a, const Vector& b) {
+    return std::sqrt((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+}
+}
+
+bool MultiRadioGroundHelper::ParseStrategy(const std::string& name, Strategy& strategy) {
+    if (name == "static") {
+        strategy = STATIC;
+    } else if (name == "greedy") {
+        strategy = GREEDY;
+    } else if (name == "hashed") {
+        strategy = HASHED;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+MultiRadioGroundHelper::MultiRadioGroundHelper(uint32_t radios, uint32_t channels, Strategy strategy, double range)
+    : m_radios(radios),
+      m_channels(channels),
+      m_strategy(strategy),
+      m_range(range),
+      m_devices(radios) {
+    NS_ASSERT_MSG(radios >= 1, "Need at least one radio per node");
+    NS_ASSERT_MSG(channels >= radios, "Need at least as many channels as radios per node");
+}
+
+void MultiRadioGroundHelper::AssignChannels(const NodeContainer& nodes) {
+    const uint32_t n = nodes.GetN();
+    m_positions.assign(n, Vector());
+    for (uint32_t i = 0; i < n; ++i) {
+        Ptr<MobilityModel> mobility = nodes.Get(i)->GetObject<MobilityModel>();
+        if (mobility) {
+            m_positions[i] = mobility->GetPosition();
+        }
+    }
+
+    m_channel.assign(n, std::vector<uint32_t>(m_radios, UNASSIGNED));
+    for (uint32_t i = 0; i < n; ++i) {
+        m_channel[i][0] = 0;  // Common channel
+    }
+    if (m_radios == 1) return;
+
+    switch (m_strategy) {
+    case STATIC:
+        for (uint32_t i = 0; i < n; ++i) {
+            for (uint32_t k = 1; k < m_radios; ++k) {
+                m_channel[i][k] = k;
+            }
+        }
+        break;
+    case GREEDY:
+        AssignGreedy(m_positions);
+        break;
+    case HASHED:
+        AssignHashed(m_positions);
+        break;
+    }
+}
+
+void MultiRadioGroundHelper::AssignGreedy(const std::vector<Vector>& positions) {
+    const uint32_t n = positions.size();
+    auto hasChannel = [this](uint32_t node, uint32_t c) {
+        return std::find(m_channel[node].begin(), m_channel[node].end(), c) != m_channel[node].end();
+    };
+    auto freeRadio = [this](uint32_t node) {
+        auto it = std::find(m_channel[node].begin(), m_channel[node].end(), UNASSIGNED);
+        return it == m_channel[node].end() ? UNASSIGNED : static_cast<uint32_t>(it - m_channel[node].begin());
+    };
+
+    // Links in range, shortest (strongest) first
+    std::vector<std::tuple<double, uint32_t, uint32_t>> links;
+    for (uint32_t i = 0; i < n; ++i) {
+        for (uint32_t j = i + 1; j < n; ++j) {
+            double d = Distance2d(positions[i], positions[j]);
+            if (d <= m_range) {
+                links.emplace_back(d, i, j);
+            }
+        }
+    }
+    std::sort(links.begin(), links.end());
+
+    struct AssignedLink {
+        Vector midpoint;
+        uint32_t channel;
+    };
+    std::vector<AssignedLink> assigned;
+    for (const auto& [d, i, j] : links) {
+        bool shared = false;
+        for (uint32_t c = 1; c < m_channels && !shared; ++c) {
+            shared = hasChannel(i, c) && hasChannel(j, c);
+        }
+        if (shared) continue;
+
+        uint32_t fi = freeRadio(i);
+        uint32_t fj = freeRadio(j);
+        Vector mid((positions[i].x + positions[j].x) / 2.0, (positions[i].y + positions[j].y) / 2.0, 0.0);
+
+        // Least-loaded channel both endpoints can tune a radio to
+        uint32_t best = UNASSIGNED;
+        uint32_t bestLoad = UNASSIGNED;
+        for (uint32_t c = 1; c < m_channels; ++c) {
+            if ((!hasChannel(i, c) && fi == UNASSIGNED) || (!hasChannel(j, c) && fj == UNASSIGNED)) continue;
+            uint32_t load = 0;
+            for (const AssignedLink& other : assigned) {
+                load += other.channel == c && Distance2d(mid, other.midpoint) <= 2.0 * m_range;
+            }
+            if (load < bestLoad) {
+                best = c;
+                bestLoad = load;
+            }
+        }
+        if (best == UNASSIGNED) continue;  // Both endpoints' data radios are taken
+
+        if (!hasChannel(i, best)) m_channel[i][fi] = best;
+        if (!hasChannel(j, best)) m_channel[j][fj] = best;
+        assigned.push_back({mid, best});
+    }
+
+    // Radios left over (few neighbours): channel least used by neighbours
+    for (uint32_t i = 0; i < n; ++i) {
+        for (uint32_t k = 1; k < m_radios; ++k) {
+            if (m_channel[i][k] != UNASSIGNED) continue;
+            uint32_t best = UNASSIGNED;
+            uint32_t bestUse = UNASSIGNED;
+            for (uint32_t c = 1; c < m_channels; ++c) {
+                if (hasChannel(i, c)) continue;
+                uint32_t use = 0;
+                for (uint32_t j = 0; j < n; ++j) {
+                    use += j != i && hasChannel(j, c) && Distance2d(positions[i], positions[j]) <= m_range;
+                }
+                if (use < bestUse) {
+                    best = c;
+                    bestUse = use;
+                }
+            }
+            m_channel[i][k] = best;
+        }
+    }
+
+    NS_LOG_INFO("Greedy channel assignment: " << assigned.size() << " of " << links.size()
+        << " links on data channels");
+}
+
+void MultiRadioGroundHelper::AssignHashed(const std::vector<Vector>& positions) {
+    const uint32_t dataChannels = DataChannels();
+    for (uint32_t i = 0; i < positions.size(); ++i) {
+        int64_t cx = static_cast<int64_t>(std::floor(positions[i].x / m_range));
+        int64_t cy = static_cast<int64_t>(std::floor(positions[i].y / m_range));
+        for (uint32_t k = 1; k < m_radios; ++k) {
+            // Integer mix of (cell, radio); collisions with the node's other radios move up
+            uint64_t h = static_cast<uint64_t>(cx) * 0x9E3779B97F4A7C15ULL;
+            h ^= static_cast<uint64_t>(cy) * 0xC2B2AE3D27D4EB4FULL + (h << 6) + (h >> 2);
+            h ^= static_cast<uint64_t>(k) * 0x165667B19E3779F9ULL + (h << 6) + (h >> 2);
+            h ^= h >> 33;
+            uint32_t c = 1 + static_cast<uint32_t>(h % dataChannels);
+            while (std::find(m_channel[i].begin(), m_channel[i].begin() + k, c) != m_channel[i].begin() + k) {
+                c = 1 + (c % dataChannels);
+            }
+            m_channel[i][k] = c;
+        }
+    }
+}
+
+NetDeviceContainer MultiRadioGroundHelper::Install(const WifiHelper& wifi, YansWifiPhyHelper& phy,
+                                                   const WifiMacHelper& mac,
+                                                   const YansWifiChannelHelper& channelHelper,
+                                                   const NodeContainer& nodes) {
+    AssignChannels(nodes);
+
+    // Radio 0: the PHY helper's current (common) channel, all nodes at once
+    m_devices.assign(m_radios, NetDeviceContainer());
+    m_devices[0] = wifi.Install(phy, mac, nodes);
+
+    // Radios 1..K−1: one channel object per orthogonal channel, created on first use
+    std::vector<Ptr<YansWifiChannel>> channels(m_channels);
+    for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+        for (uint32_t k = 1; k < m_radios; ++k) {
+            uint32_t c = m_channel[i][k];
+            if (!channels[c]) {
+                channels[c] = channelHelper.Create();
+            }
+            phy.SetChannel(channels[c]);
+            m_devices[k].Add(wifi.Install(phy, mac, nodes.Get(i)));
+        }
+    }
+    return GetAllDevices();
+}
+
+Ipv4InterfaceContainer MultiRadioGroundHelper::AssignAddresses() {
+    Ipv4InterfaceContainer primary;
+    for (uint32_t k = 0; k < m_radios; ++k) {
+        std::ostringstream base;
+        base << "10." << (k == 0 ? 1 : 100 + k) << ".0.0";
+        Ipv4AddressHelper address;
+        address.SetBase(base.str().c_str(), "255.255.0.0");
+        Ipv4InterfaceContainer interfaces = address.Assign(m_devices[k]);
+        if (k == 0) {
+            primary = interfaces;
+        }
+    }
+    return primary;
+}
+
+NetDeviceContainer MultiRadioGroundHelper::GetAllDevices() const {
+    NetDeviceContainer all;
+    for (const NetDeviceContainer& devices : m_devices) {
+        all.Add(devices);
+    }
+    return all;
+}
+
+uint32_t MultiRadioGroundHelper::GetDataLinks() const {
+    uint32_t links = 0;
+    for (uint32_t i = 0; i < m_channel.size(); ++i) {
+        for (uint32_t j = i + 1; j < m_channel.size(); ++j) {
+            if (Distance2d(m_positions[i], m_positions[j]) > m_range) continue;
+            bool shared = false;
+            for (uint32_t k = 1; k < m_radios && !shared; ++k) {
+                shared = std::find(m_channel[j].begin() + 1, m_channel[j].end(), m_channel[i][k]) != m_channel[j].end();
+            }
+            links += shared;
+        }
+    }
+    return links;
+}
+
+} // namespace ns3
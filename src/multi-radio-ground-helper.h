@@ -0,0 +1,104 @@
+/**
+ * Multi-Radio Ground Helper
+ *
+ * Purpose: K WiFi radios per ground mesh node on orthogonal channels
+ * Features:
+ * - One YansWifiChannel object per channel: radios on different channels never
+ *   hear or interfere with each other
+ * - Radio 0 of every node stays on the common channel 0 (connectivity, broadcasts);
+ *   radios 1..K−1 are assigned by strategy:
+ *     static : radio k on channel k (every node alike)
+ *     greedy : per link, shortest links first; each link gets the channel least used
+ *              by already assigned links within interference range (2 × range)
+ *     hashed : channel from a hash of the node's neighbourhood cell (range × range)
+ *              and the radio index, so nearby nodes share channels without coordination
+ * - Greedy and hashed assignments use the node positions at install time
+ * - Addresses: radio 0 → 10.1.0.0/16 (as with a single radio), radio k → 10.(100+k).0.0/16
+ * - Routing protocols installed on the nodes use every interface
+ *
+ * Usage:
+ *   MultiRadioGroundHelper radios(3, 3, MultiRadioGroundHelper::GREEDY, 200.0);
+ *   NetDeviceContainer all = radios.Install(wifi, phy, mac, channelHelper, nodes);
+ *   ... install internet stack / routing ...
+ *   Ipv4InterfaceContainer primary = radios.AssignAddresses();  // radio 0 interfaces
+ */
+
+#ifndef MULTI_RADIO_GROUND_HELPER_H
+#define MULTI_RADIO_GROUND_HELPER_H
+
+#include "ns3/node-container.h"
+#include "ns3/net-device-container.h"
+#include "ns3/ipv4-interface-container.h"
+#include "ns3/wifi-module.h"
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+class MultiRadioGroundHelper {
+public:
+    enum Strategy { STATIC, GREEDY, HASHED };
+
+    /**
+     * Parse "static" | "greedy" | "hashed"
+     *
+     * @return false for an unknown name
+     */
+    static bool ParseStrategy(const std::string& name, Strategy& strategy);
+
+    /**
+     * @param radios Radios per node (K ≥ 1)
+     * @param channels Orthogonal channels available (≥ K)
+     * @param strategy Channel assignment for radios 1..K−1
+     * @param range Radio range (m), for neighbourhoods and interference
+     */
+    MultiRadioGroundHelper(uint32_t radios, uint32_t channels, Strategy strategy, double range);
+
+    /**
+     * Create the radios. Radio 0 devices come first, in node order, installed exactly as
+     * a single-radio network; then radios 1..K−1 per node.
+     *
+     * @return All devices
+     */
+    NetDeviceContainer Install(const WifiHelper& wifi, YansWifiPhyHelper& phy, const WifiMacHelper& mac,
+                               const YansWifiChannelHelper& channelHelper, const NodeContainer& nodes);
+
+    /**
+     * Assign addresses to all radios (internet stack must be installed)
+     *
+     * @return Radio 0 interfaces (one per node, in node order)
+     */
+    Ipv4InterfaceContainer AssignAddresses();
+
+    NetDeviceContainer GetDevices(uint32_t radio) const { return m_devices[radio]; }
+    NetDeviceContainer GetAllDevices() const;
+    uint32_t GetChannel(uint32_t node, uint32_t radio) const { return m_channel[node][radio]; }
+    uint32_t GetNumRadios() const { return m_radios; }
+
+    /**
+     * Links within range at install time whose endpoints share a channel other than 0
+     */
+    uint32_t GetDataLinks() const;
+
+private:
+    void AssignChannels(const NodeContainer& nodes);
+    void AssignGreedy(const std::vector<Vector>& positions);
+    void AssignHashed(const std::vector<Vector>& positions);
+
+    /**
+     * Channels 1..C−1 for data radios (channel 0 when only one channel exists)
+     */
+    uint32_t DataChannels() const { return m_channels > 1 ? m_channels - 1 : 0; }
+
+    uint32_t m_radios;
+    uint32_t m_channels;
+    Strategy m_strategy;
+    double m_range;
+    std::vector<std::vector<uint32_t>> m_channel;   // [node][radio]
+    std::vector<Vector> m_positions;                // At install
+    std::vector<NetDeviceContainer> m_devices;      // [radio]
+};
+
+} // namespace ns3
+
+#endif // MULTI_RADIO_GROUND_HELPER_H
@@ -62,4 +62,11 @@ std::string OlsrRoutingProtocol::GetConfig() const {
     return oss.str();
 }
 
+int64_t OlsrRoutingProtocol::AssignStreams(NodeContainer nodes, int64_t stream) {
+    InternetStackHelper internet;
+    int64_t used = internet.AssignStreams(nodes, stream);
+    used += m_olsrHelper.AssignStreams(nodes, stream + used);
+    return used;
+}
+
 } // namespace ns3
@@ -3,32 +3,38 @@
  */
 
 #include "packet-tracer.h"
+#include "routing-control-classifier.h"
 #include "ns3/udp-header.h"
 #include "ns3/ipv4-header.h"
 #include "ns3/ipv4-l3-protocol.h"
 #include "ns3/wifi-net-device.h"
 #include "ns3/wifi-mac.h"
+#include <numeric>
 
 namespace ns3 {
 
-PacketTracer::PacketTracer()
-    : m_controlBytesTx(0),
-      m_controlBytesRx(0),
-      m_dataBytesTx(0),
-      m_dataBytesRx(0) {
+PacketTracer::PacketTracer() {
     // Constructor - counters initialized to 0
+    Reset();
 }
 
-void PacketTracer::Install(NetDeviceContainer devices) {
+void PacketTracer::Install(NetDeviceContainer devices, Layer layer) {
     // Hook into device trace sources at IP layer (after WiFi/LLC/SNAP headers removed)
     //
     // Strategy: Connect to Ipv4L3Protocol Send/Receive traces
     // This gives us packets at IP layer, making classification much simpler
     //
-    // Note: This requires access to the node's Ipv4 object
+    // Note: This requires access to the node's Ipv4 object. The traces are per node,
+    // so they are connected once per node; the interface index in each event
+    // tells which device (and so which layer) the packet used.
+    m_interfaceLayer.clear();  // Re-resolve interfaces against the new devices
     for (uint32_t i = 0; i < devices.GetN(); ++i) {
         Ptr<NetDevice> dev = devices.Get(i);
         Ptr<Node> node = dev->GetNode();
+        m_deviceLayer[PeekPointer(dev)] = layer;
+        if (m_hookedNodes.count(node->GetId()) > 0) {
+            continue;
+        }
 
         // Get Ipv4 protocol object from node
         Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
@@ -44,32 +50,59 @@ void PacketTracer::Install(NetDeviceContainer devices) {
                 ipv4L3->TraceConnectWithoutContext(
                     "Rx",
                     MakeCallback(&PacketTracer::RxCallback, this));
+                m_hookedNodes.insert(node->GetId());
             }
         }
     }
 }
 
 uint64_t PacketTracer::GetControlBytesTx() const {
-    return m_controlBytesTx;
+    return std::accumulate(m_controlBytesTx.begin(), m_controlBytesTx.end(), uint64_t(0));
 }
 
 uint64_t PacketTracer::GetControlBytesRx() const {
-    return m_controlBytesRx;
+    return std::accumulate(m_controlBytesRx.begin(), m_controlBytesRx.end(), uint64_t(0));
 }
 
 uint64_t PacketTracer::GetDataBytesTx() const {
-    return m_dataBytesTx;
+    return std::accumulate(m_dataBytesTx.begin(), m_dataBytesTx.end(), uint64_t(0));
 }
 
 uint64_t PacketTracer::GetDataBytesRx() const {
-    return m_dataBytesRx;
+    return std::accumulate(m_dataBytesRx.begin(), m_dataBytesRx.end(), uint64_t(0));
+}
+
+std::string PacketTracer::GetLayerName(Layer layer) {
+    switch (layer) {
+    case ISL: return "isl";
+    case GROUND: return "ground";
+    case GATEWAY: return "gateway";
+    default: return "other";
+    }
 }
 
 void PacketTracer::Reset() {
-    m_controlBytesTx = 0;
-    m_controlBytesRx = 0;
-    m_dataBytesTx = 0;
-    m_dataBytesRx = 0;
+    m_controlBytesTx.fill(0);
+    m_controlBytesRx.fill(0);
+    m_dataBytesTx.fill(0);
+    m_dataBytesRx.fill(0);
+}
+
+PacketTracer::Layer PacketTracer::GetLayer(Ptr<Ipv4> ipv4, uint32_t interface) {
+    Ptr<Node> node = ipv4->GetObject<Node>();
+    uint32_t nodeId = node->GetId();
+    if (nodeId >= m_interfaceLayer.size()) {
+        m_interfaceLayer.resize(nodeId + 1);
+    }
+    std::vector<int>& layers = m_interfaceLayer[nodeId];
+    if (interface >= layers.size()) {
+        layers.resize(interface + 1, -1);
+    }
+    if (layers[interface] < 0) {
+        auto it = m_deviceLayer.find(PeekPointer(ipv4->GetNetDevice(interface)));
+        layers[interface] = it != m_deviceLayer.end() ? it->second : OTHER;
+    }
+    return static_cast<Layer>(layers[interface]);
 }
 
 bool PacketTracer::IsDataPacket(Ptr<const Packet> packet) const {
@@ -86,16 +119,10 @@ bool PacketTracer::IsDataPacket(Ptr<const Packet> packet) const {
         return false;
     }
 
-    // Check if it's UDP protocol
-    if (ipv4Header.GetProtocol() != 17) {  // 17 = UDP
-        // Not UDP -> control packet (could be ICMP, AODV, OLSR, etc.)
-        return false;
-    }
-
-    // Extract UDP header
+    // Extract UDP header, also behind an ISL source route (protocol 253)
     UdpHeader udpHeader;
-    if (copy->RemoveHeader(udpHeader) == 0) {
-        // No UDP header found (malformed packet?)
+    if (!RoutingControlClassifier::PeekUdpHeader(ipv4Header, copy, udpHeader)) {
+        // Not UDP -> control packet (could be ICMP, AODV, OLSR, etc.)
         return false;
     }
 
@@ -108,24 +135,26 @@ bool PacketTracer::IsDataPacket(Ptr<const Packet> packet) const {
 }
 
 void PacketTracer::TxCallback(Ptr<const Packet> packet, Ptr<Ipv4> ipv4, uint32_t interface) {
-    // Note: We ignore ipv4 and interface parameters - only interested in packet
+    // Outgoing interface decides the layer
     uint32_t size = packet->GetSize();
+    Layer layer = GetLayer(ipv4, interface);
 
     if (IsDataPacket(packet)) {
-        m_dataBytesTx += size;
+        m_dataBytesTx[layer] += size;
     } else {
-        m_controlBytesTx += size;
+        m_controlBytesTx[layer] += size;
     }
 }
 
 void PacketTracer::RxCallback(Ptr<const Packet> packet, Ptr<Ipv4> ipv4, uint32_t interface) {
-    // Note: We ignore ipv4 and interface parameters - only interested in packet
+    // Incoming interface decides the layer
     uint32_t size = packet->GetSize();
+    Layer layer = GetLayer(ipv4, interface);
 
     if (IsDataPacket(packet)) {
-        m_dataBytesRx += size;
+        m_dataBytesRx[layer] += size;
     } else {
-        m_controlBytesRx += size;
+        m_controlBytesRx[layer] += size;
     }
 }
 
@@ -5,15 +5,23 @@
  * Used to compute Normalized Routing Load (NRL) metric.
  *
  * Classification logic:
- * - Data packets: UDP destination port ∈ [9, 14] (application traffic)
+ * - Data packets: UDP destination port ∈ [9, 14] (application traffic), also when
+ *   source-routed over the ISLs (UDP behind an IslSourceRouteHeader)
  * - Control packets: All other IP traffic (routing protocols AODV/OLSR/DSDV)
  *
+ * Layers: every packet is also attributed to the class of the interface it leaves or
+ * arrives on (ISL, ground WiFi, gateway; OTHER for loopback and untraced devices).
+ * The IP traces are connected once per node, however many of its devices are
+ * installed, so multi-interface nodes (satellites, multi-radio mesh nodes) count
+ * each packet once.
+ *
  * Usage:
  *   PacketTracer tracer;
- *   tracer.Install(groundDevices);  // Hook into WiFi device trace sources
+ *   tracer.Install(islDevices, PacketTracer::ISL);
+ *   tracer.Install(groundDevices, PacketTracer::GROUND);
  *   ...
- *   uint64_t controlBytes = tracer.GetControlBytesTx();
- *   uint64_t dataBytes = tracer.GetDataBytesTx();
+ *   uint64_t controlBytes = tracer.GetControlBytesTx(PacketTracer::GROUND);
+ *   uint64_t dataBytes = tracer.GetDataBytesTx(PacketTracer::GROUND);
  *   double nrl = (dataBytes > 0) ? (double)controlBytes / dataBytes : 0.0;
  */
 
@@ -23,6 +31,11 @@
 #include "ns3/core-module.h"
 #include "ns3/network-module.h"
 #include "ns3/internet-module.h"
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace ns3 {
 
@@ -33,6 +46,11 @@ namespace ns3 {
  */
 class PacketTracer {
 public:
+    /**
+     * Interface class a packet is attributed to
+     */
+    enum Layer { ISL, GROUND, GATEWAY, OTHER, NUM_LAYERS };
+
     /**
      * Constructor - initializes counters to 0.
      */
@@ -41,12 +59,13 @@ public:
     /**
      * Install packet tracer on devices.
      *
-     * Hooks into PromiscSniffer trace source to capture all packets
-     * (both TX and RX) on the specified devices.
+     * Marks the devices as belonging to a layer and hooks into the Ipv4L3Protocol
+     * Tx/Rx trace sources of their nodes (once per node) to capture all IP packets.
      *
      * @param devices NetDeviceContainer to monitor
+     * @param layer Interface class of these devices
      */
-    void Install(NetDeviceContainer devices);
+    void Install(NetDeviceContainer devices, Layer layer = GROUND);
 
     /**
      * Get total control packet bytes transmitted.
@@ -54,14 +73,14 @@ public:
      * Control packets: Routing protocol traffic (AODV/OLSR/DSDV).
      * Classification: IP packets with UDP dest port NOT in [9, 14].
      *
-     * @return Total control bytes TX
+     * @return Total control bytes TX (all layers)
      */
     uint64_t GetControlBytesTx() const;
 
     /**
      * Get total control packet bytes received.
      *
-     * @return Total control bytes RX
+     * @return Total control bytes RX (all layers)
      */
     uint64_t GetControlBytesRx() const;
 
@@ -70,17 +89,30 @@ public:
      *
      * Data packets: Application traffic (UDP dest port ∈ [9, 14]).
      *
-     * @return Total data bytes TX
+     * @return Total data bytes TX (all layers)
      */
     uint64_t GetDataBytesTx() const;
 
     /**
      * Get total data packet bytes received.
      *
-     * @return Total data bytes RX
+     * @return Total data bytes RX (all layers)
      */
     uint64_t GetDataBytesRx() const;
 
+    /**
+     * Per-layer counters (same classification as the totals)
+     */
+    uint64_t GetControlBytesTx(Layer layer) const { return m_controlBytesTx[layer]; }
+    uint64_t GetControlBytesRx(Layer layer) const { return m_controlBytesRx[layer]; }
+    uint64_t GetDataBytesTx(Layer layer) const { return m_dataBytesTx[layer]; }
+    uint64_t GetDataBytesRx(Layer layer) const { return m_dataBytesRx[layer]; }
+
+    /**
+     * Layer name for output ("isl", "ground", "gateway", "other")
+     */
+    static std::string GetLayerName(Layer layer);
+
     /**
      * Reset all counters to 0.
      *
@@ -103,6 +135,11 @@ private:
      */
     bool IsDataPacket(Ptr<const Packet> packet) const;
 
+    /**
+     * Layer of a node's interface (resolved from its device once, then cached)
+     */
+    Layer GetLayer(Ptr<Ipv4> ipv4, uint32_t interface);
+
     /**
      * TX callback - called when packet is transmitted at IP layer.
      *
@@ -121,11 +158,15 @@ private:
      */
     void RxCallback(Ptr<const Packet> packet, Ptr<Ipv4> ipv4, uint32_t interface);
 
-    // Byte counters
-    uint64_t m_controlBytesTx;  ///< Control packet bytes transmitted
-    uint64_t m_controlBytesRx;  ///< Control packet bytes received
-    uint64_t m_dataBytesTx;     ///< Data packet bytes transmitted
-    uint64_t m_dataBytesRx;     ///< Data packet bytes received
+    // Byte counters, per layer
+    std::array<uint64_t, NUM_LAYERS> m_controlBytesTx;  ///< Control packet bytes transmitted
+    std::array<uint64_t, NUM_LAYERS> m_controlBytesRx;  ///< Control packet bytes received
+    std::array<uint64_t, NUM_LAYERS> m_dataBytesTx;     ///< Data packet bytes transmitted
+    std::array<uint64_t, NUM_LAYERS> m_dataBytesRx;     ///< Data packet bytes received
+
+    std::unordered_map<const NetDevice*, Layer> m_deviceLayer;   ///< Installed devices
+    std::unordered_set<uint32_t> m_hookedNodes;                  ///< Nodes with IP traces connected
+    std::vector<std::vector<int>> m_interfaceLayer;              ///< [node][interface] cache (−1 = unresolved)
 };
 
 } // namespace ns3
@@ -0,0 +1,206 @@
+/**
+ * Phase 7: Multithreaded Resampling Engine Implementation
+ *
+ * Work is partitioned by resample index, never by data, so each worker only
+ * reads the shared columns and writes its own slice of the output array.
+ */
+
+#include "resampling-engine.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <thread>
+
+namespace ns3 {
+
+namespace {
+
+const uint64_t GOLDEN_GAMMA = 0x9e3779b97f4a7c15ULL;
+
+uint64_t Mix64(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Percentile of a sorted array (linear interpolation, like numpy's default).
+ */
+double SortedPercentile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) return 0.0;
+    double pos = q * (sorted.size() - 1);
+    size_t lo = static_cast<size_t>(std::floor(pos));
+    size_t hi = std::min(lo + 1, sorted.size() - 1);
+    double frac = pos - lo;
+    return sorted[lo] + frac * (sorted[hi] - sorted[lo]);
+}
+
+} // namespace
+
+// ============================================================================
+// CounterRng
+// ============================================================================
+
+CounterRng::CounterRng(uint64_t seed, uint64_t stream, uint64_t substream)
+    : m_state(Mix64(Mix64(seed + GOLDEN_GAMMA * (stream + 1)) ^ (substream * GOLDEN_GAMMA))) {
+}
+
+uint64_t CounterRng::Next() {
+    m_state += GOLDEN_GAMMA;
+    return Mix64(m_state);
+}
+
+// ============================================================================
+// ResamplingEngine
+// ============================================================================
+
+ResamplingEngine::ResamplingEngine(uint64_t seed, uint32_t threads)
+    : m_seed(seed),
+      m_threads(threads) {
+    if (m_threads == 0) {
+        m_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+uint64_t ResamplingEngine::StreamId(const std::string& name) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned char c : name) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+template <typename Fn>
+void ResamplingEngine::ParallelFor(uint32_t count, Fn fn) const {
+    uint32_t workers = std::min(m_threads, std::max(1u, count));
+    if (workers <= 1) {
+        fn(0u, count, 0u);
+        return;
+    }
+
+    std::vector<std::thread> pool;
+    pool.reserve(workers);
+    uint32_t chunk = count / workers;
+    uint32_t extra = count % workers;
+    uint32_t begin = 0;
+    for (uint32_t w = 0; w < workers; ++w) {
+        uint32_t end = begin + chunk + (w < extra ? 1 : 0);
+        pool.emplace_back(fn, begin, end, w);
+        begin = end;
+    }
+    for (std::thread& t : pool) {
+        t.join();
+    }
+}
+
+BootstrapResult ResamplingEngine::BootstrapMean(const std::vector<double>& samples,
+                                                uint32_t resamples,
+                                                double confidence,
+                                                uint64_t stream) const {
+    BootstrapResult result;
+    result.n = samples.size();
+    result.resamples = resamples;
+    if (samples.empty() || resamples == 0) return result;
+
+    const double* x = samples.data();
+    const uint32_t n = static_cast<uint32_t>(samples.size());
+    result.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / n;
+
+    std::vector<double> means(resamples);
+
+    ParallelFor(resamples, [&](uint32_t begin, uint32_t end, uint32_t) {
+        for (uint32_t r = begin; r < end; ++r) {
+            CounterRng rng(m_seed, stream, r);
+            double sum = 0.0;
+            for (uint32_t i = 0; i < n; ++i) {
+                sum += x[rng.NextBelow(n)];
+            }
+            means[r] = sum / n;
+        }
+    });
+
+    double meanOfMeans = std::accumulate(means.begin(), means.end(), 0.0) / resamples;
+    double ss = 0.0;
+    for (double m : means) {
+        ss += (m - meanOfMeans) * (m - meanOfMeans);
+    }
+    result.stdError = (resamples > 1) ? std::sqrt(ss / (resamples - 1)) : 0.0;
+
+    std::sort(means.begin(), means.end());
+    double alpha = 1.0 - confidence;
+    result.ciLower = SortedPercentile(means, alpha / 2.0);
+    result.ciUpper = SortedPercentile(means, 1.0 - alpha / 2.0);
+    return result;
+}
+
+PermutationResult ResamplingEngine::PermutationTest(const std::vector<std::vector<double>>& groups,
+                                                    uint32_t permutations,
+                                                    uint64_t stream) const {
+    PermutationResult result;
+    result.permutations = permutations;
+
+    // Pool all observations into one column; group g owns [offset[g], offset[g+1])
+    std::vector<double> pooled;
+    std::vector<uint32_t> offsets = {0};
+    for (const std::vector<double>& g : groups) {
+        if (g.empty()) continue;
+        pooled.insert(pooled.end(), g.begin(), g.end());
+        offsets.push_back(static_cast<uint32_t>(pooled.size()));
+    }
+    result.groups = offsets.size() - 1;
+    if (result.groups < 2) return result;
+
+    const uint32_t total = static_cast<uint32_t>(pooled.size());
+    const uint32_t k = result.groups;
+    const double grandSum = std::accumulate(pooled.begin(), pooled.end(), 0.0);
+    const double grandTerm = grandSum * grandSum / total;
+
+    // SS_between = Σ S_g²/n_g − S²/N for group sums S_g of the current labeling
+    auto betweenSs = [&](const double* column) {
+        double acc = 0.0;
+        for (uint32_t g = 0; g < k; ++g) {
+            double s = 0.0;
+            for (uint32_t i = offsets[g]; i < offsets[g + 1]; ++i) {
+                s += column[i];
+            }
+            acc += s * s / (offsets[g + 1] - offsets[g]);
+        }
+        return std::max(0.0, acc - grandTerm);
+    };
+
+    result.statistic = betweenSs(pooled.data());
+    result.valid = true;
+    if (permutations == 0) return result;
+
+    // Relative tolerance so ties with the observed labeling count as extreme
+    const double threshold = result.statistic * (1.0 - 1e-12);
+    const uint32_t lastGroupStart = offsets[k - 1];
+    std::vector<uint64_t> extreme(std::min(m_threads, std::max(1u, permutations)), 0);
+
+    ParallelFor(permutations, [&](uint32_t begin, uint32_t end, uint32_t worker) {
+        std::vector<double> column(total);
+        uint64_t count = 0;
+        for (uint32_t r = begin; r < end; ++r) {
+            // Fresh copy per permutation keeps each relabeling a pure function of r
+            std::copy(pooled.begin(), pooled.end(), column.begin());
+            CounterRng rng(m_seed, stream, r);
+
+            // Partial Fisher-Yates: the last group receives whatever remains
+            for (uint32_t i = 0; i < lastGroupStart; ++i) {
+                uint32_t j = i + rng.NextBelow(total - i);
+                std::swap(column[i], column[j]);
+            }
+            if (betweenSs(column.data()) >= threshold) {
+                count++;
+            }
+        }
+        extreme[worker] = count;
+    });
+
+    uint64_t extremeTotal = std::accumulate(extreme.begin(), extreme.end(), uint64_t(0));
+    result.pValue = (1.0 + extremeTotal) / (1.0 + permutations);
+    return result;
+}
+
+} // namespace ns3
@@ -0,0 +1,138 @@
+/**
+ * Phase 7: Multithreaded Resampling Engine
+ *
+ * Non-parametric companions to the ANOVA in ResultAggregator:
+ * - Percentile bootstrap CI of a cell mean
+ * - Permutation test of equal means across k groups (k = 2 is the two-sample test)
+ *
+ * Design:
+ * - Samples live in contiguous double columns; inner loops are plain gathers/sums
+ * - Resamples are split across std::thread workers in contiguous chunks
+ * - Counter-based RNG: every resample r draws from its own SplitMix64 stream keyed
+ *   by (seed, stream, r), so results are bit-identical for any thread count and
+ *   do not depend on which other tests were run before
+ *
+ * Usage:
+ *   ResamplingEngine engine(12345, 0);             // seed, threads (0 = all cores)
+ *   BootstrapResult ci = engine.BootstrapMean(samples, 100000, 0.95, 1);
+ *   PermutationResult p = engine.PermutationTest({aodv, olsr, dsdv}, 100000, 2);
+ */
+
+#ifndef RESAMPLING_ENGINE_H
+#define RESAMPLING_ENGINE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * Counter-based random stream (SplitMix64).
+ *
+ * State i of stream k is key(k) + i·γ; the output is a bijective mix of the state,
+ * so any (stream, counter) pair can be evaluated independently of all others.
+ */
+class CounterRng {
+public:
+    CounterRng(uint64_t seed, uint64_t stream, uint64_t substream);
+
+    uint64_t Next();
+
+    /**
+     * Uniform integer in [0, bound) (Lemire multiply-shift, bound < 2^32)
+     */
+    uint32_t NextBelow(uint32_t bound) {
+        return static_cast<uint32_t>(((Next() >> 32) * bound) >> 32);
+    }
+
+private:
+    uint64_t m_state;
+};
+
+/**
+ * Bootstrap confidence interval of a mean.
+ */
+struct BootstrapResult {
+    uint64_t n;          // Sample size
+    uint32_t resamples;  // Number of bootstrap resamples
+    double mean;         // Observed mean
+    double ciLower;      // Percentile CI lower bound
+    double ciUpper;      // Percentile CI upper bound
+    double stdError;     // Standard deviation of the bootstrap means
+
+    BootstrapResult()
+        : n(0), resamples(0), mean(0.0), ciLower(0.0), ciUpper(0.0), stdError(0.0) {}
+};
+
+/**
+ * Permutation test of equal group means.
+ */
+struct PermutationResult {
+    uint32_t groups;        // Number of non-empty groups
+    uint32_t permutations;  // Number of random relabelings
+    double statistic;       // Observed Σ n_g·(mean_g − grand mean)² (between-group SS)
+    double pValue;          // (1 + #{T_perm ≥ T_obs}) / (1 + permutations)
+    bool valid;             // false if fewer than 2 groups
+
+    PermutationResult()
+        : groups(0), permutations(0), statistic(0.0), pValue(1.0), valid(false) {}
+};
+
+class ResamplingEngine {
+public:
+    /**
+     * @param seed Base seed of all random streams
+     * @param threads Worker threads (0 = std::thread::hardware_concurrency())
+     */
+    ResamplingEngine(uint64_t seed, uint32_t threads);
+
+    uint32_t GetThreads() const { return m_threads; }
+
+    /**
+     * Stream id for a named test (64-bit FNV-1a, identical on every toolchain,
+     * unlike std::hash)
+     */
+    static uint64_t StreamId(const std::string& name);
+
+    /**
+     * Percentile bootstrap CI of the mean.
+     *
+     * @param samples Observations (contiguous column)
+     * @param resamples Number of bootstrap resamples
+     * @param confidence Confidence level, e.g. 0.95
+     * @param stream RNG stream id (use a distinct id per test for independent draws)
+     */
+    BootstrapResult BootstrapMean(const std::vector<double>& samples,
+                                  uint32_t resamples,
+                                  double confidence,
+                                  uint64_t stream) const;
+
+    /**
+     * Permutation test that all groups share the same mean.
+     *
+     * The between-group sum of squares is used as the statistic: the total SS is
+     * invariant under relabeling, so it orders permutations exactly like the ANOVA F.
+     *
+     * @param groups One column per group (empty groups are ignored)
+     * @param permutations Number of random relabelings
+     * @param stream RNG stream id
+     */
+    PermutationResult PermutationTest(const std::vector<std::vector<double>>& groups,
+                                      uint32_t permutations,
+                                      uint64_t stream) const;
+
+private:
+    /**
+     * Run fn(begin, end, worker) over [0, count) split into one chunk per worker.
+     */
+    template <typename Fn>
+    void ParallelFor(uint32_t count, Fn fn) const;
+
+    uint64_t m_seed;
+    uint32_t m_threads;
+};
+
+} // namespace ns3
+
+#endif // RESAMPLING_ENGINE_H
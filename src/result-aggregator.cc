@@ -0,0 +1,445 @@
+/**
+ * Phase 7: Streaming Result Aggregator Implementation
+ *
+ * All statistics are derived from Welford moments, so adding a run is O(metrics)
+ * and a report is O(cells) regardless of how many runs have been aggregated.
+ */
+
+#include "result-aggregator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <set>
+#include <sstream>
+
+namespace ns3 {
+
+// ============================================================================
+// WelfordAccumulator
+// ============================================================================
+
+WelfordAccumulator::WelfordAccumulator()
+    : n(0),
+      mean(0.0),
+      m2(0.0),
+      min(std::numeric_limits<double>::infinity()),
+      max(-std::numeric_limits<double>::infinity()) {
+}
+
+void WelfordAccumulator::Add(double x) {
+    n++;
+    double delta = x - mean;
+    mean += delta / n;
+    m2 += delta * (x - mean);
+    min = std::min(min, x);
+    max = std::max(max, x);
+}
+
+void WelfordAccumulator::Merge(const WelfordAccumulator& other) {
+    if (other.n == 0) return;
+    if (n == 0) {
+        *this = other;
+        return;
+    }
+
+    // Chan et al. pairwise update
+    uint64_t total = n + other.n;
+    double delta = other.mean - mean;
+    mean += delta * other.n / total;
+    m2 += other.m2 + delta * delta * (static_cast<double>(n) * other.n / total);
+    n = total;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+}
+
+double WelfordAccumulator::Variance() const {
+    return (n > 1) ? m2 / (n - 1) : 0.0;
+}
+
+double WelfordAccumulator::StdDev() const {
+    return std::sqrt(Variance());
+}
+
+double WelfordAccumulator::Sem() const {
+    return (n > 0) ? StdDev() / std::sqrt(static_cast<double>(n)) : 0.0;
+}
+
+bool ResultCellKey::operator<(const ResultCellKey& other) const {
+    if (mobility != other.mobility) return mobility < other.mobility;
+    if (nodeCount != other.nodeCount) return nodeCount < other.nodeCount;
+    return protocol < other.protocol;
+}
+
+// ============================================================================
+// Distribution functions
+// ============================================================================
+
+namespace {
+
+/**
+ * Continued fraction for the regularized incomplete beta function (modified Lentz).
+ */
+double BetaContinuedFraction(double a, double b, double x) {
+    const int MAX_ITER = 300;
+    const double EPS = 1e-14;
+    const double TINY = 1e-300;
+
+    double qab = a + b;
+    double qap = a + 1.0;
+    double qam = a - 1.0;
+    double c = 1.0;
+    double d = 1.0 - qab * x / qap;
+    if (std::fabs(d) < TINY) d = TINY;
+    d = 1.0 / d;
+    double h = d;
+
+    for (int m = 1; m <= MAX_ITER; ++m) {
+        int m2 = 2 * m;
+        double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+        d = 1.0 + aa * d;
+        if (std::fabs(d) < TINY) d = TINY;
+        c = 1.0 + aa / c;
+        if (std::fabs(c) < TINY) c = TINY;
+        d = 1.0 / d;
+        h *= d * c;
+
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+        d = 1.0 + aa * d;
+        if (std::fabs(d) < TINY) d = TINY;
+        c = 1.0 + aa / c;
+        if (std::fabs(c) < TINY) c = TINY;
+        d = 1.0 / d;
+        double del = d * c;
+        h *= del;
+        if (std::fabs(del - 1.0) < EPS) break;
+    }
+    return h;
+}
+
+/**
+ * Regularized incomplete beta function I_x(a, b).
+ */
+double RegularizedIncompleteBeta(double a, double b, double x) {
+    if (x <= 0.0) return 0.0;
+    if (x >= 1.0) return 1.0;
+
+    double lnFront = std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b)
+                   + a * std::log(x) + b * std::log(1.0 - x);
+    double front = std::exp(lnFront);
+
+    // Use the symmetry relation where the continued fraction converges fastest
+    if (x < (a + 1.0) / (a + b + 2.0)) {
+        return front * BetaContinuedFraction(a, b, x) / a;
+    }
+    return 1.0 - front * BetaContinuedFraction(b, a, 1.0 - x) / b;
+}
+
+} // namespace
+
+double StudentTCdf(double t, double df) {
+    if (df <= 0.0) return 0.5;
+    double x = df / (df + t * t);
+    double tail = 0.5 * RegularizedIncompleteBeta(df / 2.0, 0.5, x);
+    return (t > 0.0) ? 1.0 - tail : tail;
+}
+
+double StudentTQuantile(double p, double df) {
+    if (p <= 0.0) return -std::numeric_limits<double>::infinity();
+    if (p >= 1.0) return std::numeric_limits<double>::infinity();
+    if (p == 0.5 || df <= 0.0) return 0.0;
+
+    // Solve on the upper half and mirror (CDF is monotone, bisection is robust)
+    double target = (p > 0.5) ? p : 1.0 - p;
+    double lo = 0.0;
+    double hi = 1.0;
+    while (StudentTCdf(hi, df) < target && hi < 1e6) {
+        hi *= 2.0;
+    }
+    for (int i = 0; i < 200 && (hi - lo) > 1e-12 * hi; ++i) {
+        double mid = 0.5 * (lo + hi);
+        if (StudentTCdf(mid, df) < target) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    double q = 0.5 * (lo + hi);
+    return (p > 0.5) ? q : -q;
+}
+
+double FDistributionSf(double f, double d1, double d2) {
+    if (f <= 0.0 || d1 <= 0.0 || d2 <= 0.0) return 1.0;
+    return RegularizedIncompleteBeta(d2 / 2.0, d1 / 2.0, d2 / (d2 + d1 * f));
+}
+
+// ============================================================================
+// ResultAggregator
+// ============================================================================
+
+ResultAggregator::ResultAggregator(std::vector<std::string> metrics)
+    : m_metrics(std::move(metrics)),
+      m_runs(0),
+      m_retainSamples(false),
+      m_confidence(0.95) {
+}
+
+int ResultAggregator::MetricIndex(const std::string& metric) const {
+    for (size_t i = 0; i < m_metrics.size(); ++i) {
+        if (m_metrics[i] == metric) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+void ResultAggregator::Add(const RunResult& run) {
+    Cell& cell = m_cells[run.cell];
+    if (cell.acc.empty()) {
+        cell.acc.resize(m_metrics.size());
+        if (m_retainSamples) {
+            cell.samples.resize(m_metrics.size());
+        }
+    }
+
+    for (size_t i = 0; i < m_metrics.size(); ++i) {
+        auto it = run.metrics.find(m_metrics[i]);
+        if (it == run.metrics.end()) continue;
+        cell.acc[i].Add(it->second);
+        if (m_retainSamples) {
+            cell.samples[i].push_back(it->second);
+        }
+    }
+    m_runs++;
+}
+
+std::vector<ResultCellKey> ResultAggregator::GetCells() const {
+    std::vector<ResultCellKey> cells;
+    cells.reserve(m_cells.size());
+    for (const auto& [key, cell] : m_cells) {
+        cells.push_back(key);
+    }
+    return cells;
+}
+
+CellSummary ResultAggregator::Summarize(const ResultCellKey& key, const std::string& metric) const {
+    CellSummary s{};
+    int idx = MetricIndex(metric);
+    auto it = m_cells.find(key);
+    if (idx < 0 || it == m_cells.end()) return s;
+
+    const WelfordAccumulator& acc = it->second.acc[idx];
+    s.n = acc.n;
+    if (acc.n == 0) return s;
+
+    s.mean = acc.mean;
+    s.std = acc.StdDev();
+    s.sem = acc.Sem();
+    double margin = 0.0;
+    if (acc.n > 1) {
+        double tCrit = StudentTQuantile(0.5 + m_confidence / 2.0, acc.n - 1);
+        margin = tCrit * s.sem;
+    }
+    s.ciLower = s.mean - margin;
+    s.ciUpper = s.mean + margin;
+    s.cv = (s.mean > 0.0) ? (s.std / s.mean) * 100.0 : 0.0;
+    s.min = acc.min;
+    s.max = acc.max;
+    return s;
+}
+
+AnovaResult ResultAggregator::OneWayAnova(const std::string& metric,
+                                          const std::string& mobility,
+                                          uint32_t nodeCount) const {
+    AnovaResult result;
+    int idx = MetricIndex(metric);
+    if (idx < 0) return result;
+
+    // Collect groups of this stratum and the grand mean
+    std::vector<const WelfordAccumulator*> groups;
+    WelfordAccumulator total;
+    for (const auto& [key, cell] : m_cells) {
+        if (key.mobility != mobility || key.nodeCount != nodeCount) continue;
+        const WelfordAccumulator& acc = cell.acc[idx];
+        if (acc.n == 0) continue;
+        groups.push_back(&acc);
+        total.Merge(acc);
+    }
+
+    result.groups = groups.size();
+    if (groups.size() < 2 || total.n <= groups.size()) return result;
+
+    double ssBetween = 0.0;
+    double ssWithin = 0.0;
+    for (const WelfordAccumulator* acc : groups) {
+        double d = acc->mean - total.mean;
+        ssBetween += acc->n * d * d;
+        ssWithin += acc->m2;
+    }
+
+    result.dfBetween = groups.size() - 1.0;
+    result.dfWithin = static_cast<double>(total.n - groups.size());
+    double ssTotal = ssBetween + ssWithin;
+    result.etaSquared = (ssTotal > 0.0) ? ssBetween / ssTotal : 0.0;
+
+    if (ssWithin > 0.0) {
+        result.fStat = (ssBetween / result.dfBetween) / (ssWithin / result.dfWithin);
+        result.pValue = FDistributionSf(result.fStat, result.dfBetween, result.dfWithin);
+    } else {
+        // Zero within-group variance: F is unbounded unless the means coincide too
+        result.fStat = (ssBetween > 0.0) ? std::numeric_limits<double>::infinity() : 0.0;
+        result.pValue = (ssBetween > 0.0) ? 0.0 : 1.0;
+    }
+    result.valid = true;
+    return result;
+}
+
+double ResultAggregator::CohensD(const ResultCellKey& a, const ResultCellKey& b,
+                                 const std::string& metric) const {
+    int idx = MetricIndex(metric);
+    auto itA = m_cells.find(a);
+    auto itB = m_cells.find(b);
+    if (idx < 0 || itA == m_cells.end() || itB == m_cells.end()) return 0.0;
+
+    const WelfordAccumulator& accA = itA->second.acc[idx];
+    const WelfordAccumulator& accB = itB->second.acc[idx];
+    if (accA.n < 2 || accB.n < 2) return 0.0;
+
+    double pooled = std::sqrt((accA.m2 + accB.m2) / (accA.n + accB.n - 2.0));
+    return (pooled > 0.0) ? (accA.mean - accB.mean) / pooled : 0.0;
+}
+
+const std::vector<double>& ResultAggregator::GetSamples(const ResultCellKey& key,
+                                                        const std::string& metric) const {
+    static const std::vector<double> EMPTY;
+    int idx = MetricIndex(metric);
+    auto it = m_cells.find(key);
+    if (idx < 0 || it == m_cells.end() || it->second.samples.empty()) return EMPTY;
+    return it->second.samples[idx];
+}
+
+void ResultAggregator::PrintSummary(std::ostream& os) const {
+    // Group cells into (mobility, node count) strata
+    std::set<std::pair<std::string, uint32_t>> strata;
+    for (const auto& [key, cell] : m_cells) {
+        strata.insert({key.mobility, key.nodeCount});
+    }
+
+    os << "=== Result Summary (" << m_runs << " runs, " << m_cells.size() << " cells, "
+       << static_cast<int>(m_confidence * 100) << "% CI) ===\n";
+
+    for (const auto& [mobility, nodeCount] : strata) {
+        os << "\n--- mobility=" << mobility << ", nodes=" << nodeCount << " ---\n";
+
+        for (const std::string& metric : m_metrics) {
+            os << "\n  " << metric << ":\n";
+            os << "    " << std::left << std::setw(10) << "protocol" << std::right
+               << std::setw(6) << "n" << std::setw(12) << "mean" << std::setw(12) << "std"
+               << std::setw(26) << "CI" << std::setw(10) << "cv%" << "\n";
+
+            std::vector<ResultCellKey> keys;
+            for (const auto& [key, cell] : m_cells) {
+                if (key.mobility != mobility || key.nodeCount != nodeCount) continue;
+                CellSummary s = Summarize(key, metric);
+                if (s.n == 0) continue;
+                keys.push_back(key);
+
+                std::ostringstream ci;
+                ci << std::fixed << std::setprecision(4) << "[" << s.ciLower << ", " << s.ciUpper << "]";
+                os << "    " << std::left << std::setw(10) << key.protocol << std::right
+                   << std::setw(6) << s.n << std::fixed << std::setprecision(4)
+                   << std::setw(12) << s.mean << std::setw(12) << s.std
+                   << std::setw(26) << ci.str() << std::setprecision(2) << std::setw(10) << s.cv << "\n";
+            }
+
+            AnovaResult anova = OneWayAnova(metric, mobility, nodeCount);
+            if (anova.valid) {
+                os << "    ANOVA: F(" << static_cast<uint64_t>(anova.dfBetween) << ","
+                   << static_cast<uint64_t>(anova.dfWithin) << ")="
+                   << std::setprecision(4) << anova.fStat << ", p=" << std::setprecision(6) << anova.pValue
+                   << ", eta^2=" << std::setprecision(4) << anova.etaSquared
+                   << (anova.pValue < 0.05 ? " (significant)" : "") << "\n";
+            }
+
+            for (size_t i = 0; i < keys.size(); ++i) {
+                for (size_t j = i + 1; j < keys.size(); ++j) {
+                    double d = CohensD(keys[i], keys[j], metric);
+                    os << "    Cohen's d " << keys[i].protocol << " vs " << keys[j].protocol
+                       << ": " << std::setprecision(3) << d << "\n";
+                }
+            }
+        }
+    }
+    os.unsetf(std::ios_base::floatfield);
+}
+
+bool ResultAggregator::WriteSummaryCsv(const std::string& path) const {
+    std::ofstream csv(path);
+    if (!csv) return false;
+
+    csv << "protocol,mobility,nodes,metric,n,mean,std,sem,ci_lower,ci_upper,cv_percent,min,max\n";
+    csv << std::setprecision(10);
+    for (const auto& [key, cell] : m_cells) {
+        for (const std::string& metric : m_metrics) {
+            CellSummary s = Summarize(key, metric);
+            if (s.n == 0) continue;
+            csv << key.protocol << "," << key.mobility << "," << key.nodeCount << ","
+                << metric << "," << s.n << "," << s.mean << "," << s.std << "," << s.sem << ","
+                << s.ciLower << "," << s.ciUpper << "," << s.cv << "," << s.min << "," << s.max << "\n";
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// CSV parsing
+// ============================================================================
+
+bool ParseResultCsv(const std::string& path, RunResult& out) {
+    std::ifstream in(path);
+    if (!in) return false;
+
+    std::map<std::string, std::string> rows;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        size_t comma = line.find(',');
+        if (comma == std::string::npos) continue;
+        rows[line.substr(0, comma)] = line.substr(comma + 1);
+    }
+    rows.erase("metric"); // Header row
+
+    auto get = [&rows](const std::string& key) -> std::string {
+        auto it = rows.find(key);
+        return (it != rows.end()) ? it->second : std::string();
+    };
+
+    std::string protocol = get("ground_routing");
+    if (protocol.empty()) protocol = get("isl_routing");
+    if (protocol.empty()) return false;
+
+    std::string groundNodes = get("ground_nodes");
+    std::string mobility = get("ground_mobility");
+    if (mobility.empty()) mobility = groundNodes.empty() ? "none" : "unknown";
+
+    std::transform(protocol.begin(), protocol.end(), protocol.begin(), ::toupper);
+
+    out = RunResult();
+    out.cell.protocol = protocol;
+    out.cell.mobility = mobility;
+    out.cell.nodeCount = static_cast<uint32_t>(
+        std::strtoul((groundNodes.empty() ? get("satellites") : groundNodes).c_str(), nullptr, 10));
+    out.seed = static_cast<uint32_t>(std::strtoul(get("seed").c_str(), nullptr, 10));
+
+    // Keep every numeric row as a metric
+    for (const auto& [key, value] : rows) {
+        char* end = nullptr;
+        double v = std::strtod(value.c_str(), &end);
+        if (end != value.c_str() && *end == '\0') {
+            out.metrics[key] = v;
+        }
+    }
+    return true;
+}
+
+} // namespace ns3
@@ -0,0 +1,216 @@
+/**
+ * Phase 7: Streaming Result Aggregator
+ *
+ * Maintains running statistics over simulation result CSVs as they arrive,
+ * replacing the per-file pandas loading in the analysis scripts for large sweeps.
+ *
+ * Design:
+ * - One cell per (protocol, mobility, node count)
+ * - One Welford accumulator per tracked metric per cell (O(1) update, numerically stable)
+ * - ANOVA, η², Cohen's d and t-based CIs computed from accumulator moments only
+ * - Optional raw sample columns per cell (for resampling tests)
+ *
+ * Usage:
+ *   ResultAggregator agg({"pdr", "avg_delay_ms", "nrl"});
+ *   RunResult run;
+ *   if (ParseResultCsv("results/aodv_seed1.csv", run)) agg.Add(run);
+ *   agg.PrintSummary(std::cout);
+ *   AnovaResult anova = agg.OneWayAnova("nrl", "manhattan", 20);
+ */
+
+#ifndef RESULT_AGGREGATOR_H
+#define RESULT_AGGREGATOR_H
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * Welford running mean/variance accumulator.
+ *
+ * Supports merging (Chan et al. parallel update) so partial sweeps can be combined.
+ */
+struct WelfordAccumulator {
+    uint64_t n;    // Number of samples
+    double mean;   // Running mean
+    double m2;     // Sum of squared deviations from the mean
+    double min;    // Smallest sample
+    double max;    // Largest sample
+
+    WelfordAccumulator();
+
+    void Add(double x);
+    void Merge(const WelfordAccumulator& other);
+
+    double Variance() const; // Sample variance (n-1), 0 if n < 2
+    double StdDev() const;
+    double Sem() const;      // Standard error of the mean
+};
+
+/**
+ * Result cell key: one experimental configuration.
+ */
+struct ResultCellKey {
+    std::string protocol;  // Ground protocol (or ISL protocol for satellite-only runs)
+    std::string mobility;  // Ground mobility model ("none" for satellite-only runs)
+    uint32_t nodeCount;    // Ground nodes (or satellites for satellite-only runs)
+
+    ResultCellKey() : nodeCount(0) {}
+    ResultCellKey(std::string p, std::string m, uint32_t n)
+        : protocol(std::move(p)), mobility(std::move(m)), nodeCount(n) {}
+
+    bool operator<(const ResultCellKey& other) const;
+};
+
+/**
+ * One simulation run, as parsed from a unified-simulation CSV.
+ */
+struct RunResult {
+    ResultCellKey cell;
+    uint32_t seed;
+    std::map<std::string, double> metrics; // metric name → value (all numeric rows)
+
+    RunResult() : seed(0) {}
+};
+
+/**
+ * Per-cell summary for one metric.
+ */
+struct CellSummary {
+    uint64_t n;
+    double mean;
+    double std;
+    double sem;
+    double ciLower;
+    double ciUpper;
+    double cv;    // Coefficient of variation (%)
+    double min;
+    double max;
+};
+
+/**
+ * One-way ANOVA result (protocol factor within one mobility/node-count stratum).
+ */
+struct AnovaResult {
+    uint32_t groups;
+    double fStat;
+    double dfBetween;
+    double dfWithin;
+    double pValue;
+    double etaSquared;  // SS_between / SS_total
+    bool valid;         // false if fewer than 2 groups or no within-group df
+
+    AnovaResult()
+        : groups(0), fStat(0.0), dfBetween(0.0), dfWithin(0.0),
+          pValue(1.0), etaSquared(0.0), valid(false) {}
+};
+
+/**
+ * Streaming aggregator over run results.
+ */
+class ResultAggregator {
+public:
+    /**
+     * @param metrics Metric names to track (CSV "metric" column values)
+     */
+    explicit ResultAggregator(std::vector<std::string> metrics);
+
+    /**
+     * Keep raw samples per cell (needed for bootstrap/permutation tests).
+     * Must be set before the first Add().
+     */
+    void SetRetainSamples(bool retain) { m_retainSamples = retain; }
+
+    /**
+     * Add one run. Metrics missing from the run are skipped for that run.
+     */
+    void Add(const RunResult& run);
+
+    uint64_t GetRunCount() const { return m_runs; }
+    const std::vector<std::string>& GetMetrics() const { return m_metrics; }
+    std::vector<ResultCellKey> GetCells() const;
+
+    /**
+     * Summary for one cell/metric (t-based CI at the configured confidence).
+     * Returns n = 0 if the cell or metric is unknown.
+     */
+    CellSummary Summarize(const ResultCellKey& cell, const std::string& metric) const;
+
+    /**
+     * One-way ANOVA across protocols for a (mobility, node count) stratum.
+     */
+    AnovaResult OneWayAnova(const std::string& metric,
+                            const std::string& mobility,
+                            uint32_t nodeCount) const;
+
+    /**
+     * Cohen's d (pooled standard deviation) between two cells: (mean_a - mean_b) / s_pooled.
+     * Returns 0 if either cell has fewer than 2 samples.
+     */
+    double CohensD(const ResultCellKey& a, const ResultCellKey& b, const std::string& metric) const;
+
+    /**
+     * Raw samples for one cell/metric (empty unless SetRetainSamples(true)).
+     */
+    const std::vector<double>& GetSamples(const ResultCellKey& cell, const std::string& metric) const;
+
+    void SetConfidence(double confidence) { m_confidence = confidence; }
+
+    /**
+     * Print per-cell summary tables, ANOVA per stratum and pairwise Cohen's d.
+     */
+    void PrintSummary(std::ostream& os) const;
+
+    /**
+     * Write per-cell summaries as CSV (one row per cell × metric).
+     */
+    bool WriteSummaryCsv(const std::string& path) const;
+
+private:
+    struct Cell {
+        std::vector<WelfordAccumulator> acc;       // Indexed like m_metrics
+        std::vector<std::vector<double>> samples;  // Indexed like m_metrics (optional)
+    };
+
+    int MetricIndex(const std::string& metric) const;
+
+    std::vector<std::string> m_metrics;
+    std::map<ResultCellKey, Cell> m_cells;
+    uint64_t m_runs;
+    bool m_retainSamples;
+    double m_confidence;
+};
+
+/**
+ * Parse a unified-simulation key-value CSV ("metric,value").
+ *
+ * Cell key: protocol = ground_routing (else isl_routing), mobility = ground_mobility
+ * (else "none" for satellite-only runs), node count = ground_nodes (else satellites).
+ *
+ * @return false if the file cannot be read or has no routing protocol row
+ */
+bool ParseResultCsv(const std::string& path, RunResult& out);
+
+/**
+ * Student's t cumulative distribution function.
+ */
+double StudentTCdf(double t, double df);
+
+/**
+ * Student's t quantile (inverse CDF), e.g. StudentTQuantile(0.975, 14) = 2.145.
+ */
+double StudentTQuantile(double p, double df);
+
+/**
+ * Upper tail probability P(F > f) of the F distribution with (d1, d2) degrees of freedom.
+ */
+double FDistributionSf(double f, double d1, double d2);
+
+} // namespace ns3
+
+#endif // RESULT_AGGREGATOR_H
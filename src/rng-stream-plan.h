@@ -0,0 +1,73 @@
+/**
+ * RNG Stream Plan
+ *
+ * Purpose: Fixed RNG stream numbers per simulation component (common random numbers)
+ * Features:
+ * - Every component (ground mobility, ground devices, routing, traffic, ...) owns a
+ *   block of streams; every node, device or flow owns a fixed slot inside its block
+ * - A slot's stream numbers depend only on (component, slot), never on what other
+ *   components created before it, so the same seed gives the same mobility, traffic
+ *   and MAC draws whichever routing protocol runs
+ * - Without a plan, ns-3 numbers streams automatically in object creation order, and
+ *   protocols that create more random variables shift the streams of everything after
+ *
+ * Usage:
+ *   RngSeedManager::SetSeed(seed);
+ *   for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+ *       RngStreamPlan::Assign(RngStreamPlan::GROUND_MOBILITY, i, [&](int64_t stream) {
+ *           return mobility.AssignStreams(NodeContainer(nodes.Get(i)), stream);
+ *       });
+ *   }
+ */
+
+#ifndef RNG_STREAM_PLAN_H
+#define RNG_STREAM_PLAN_H
+
+#include "ns3/assert.h"
+#include <cstdint>
+#include <functional>
+
+namespace ns3 {
+
+class RngStreamPlan {
+public:
+    enum Component {
+        GROUND_MOBILITY = 0,  // Slot = ground node
+        GROUND_PLACEMENT,     // Shared position generators (slot 0)
+        GROUND_DEVICES,       // Slot = ground device (PHY, MAC backoff, rate manager)
+        GROUND_ROUTING,       // Slot = ground node (internet stack + protocol jitter)
+        ISL_ROUTING,          // Slot = satellite (internet stack + protocol jitter)
+        ISL_FAILURES,         // Random failure schedule (slot 0)
+        TRAFFIC,              // Slot = flow
+        GROUND_CHANNEL,       // Shared ground propagation loss (slot 0)
+        NUM_COMPONENTS
+    };
+
+    static const int64_t SLOT_SIZE = 64;              // Streams per node / device / flow
+    static const uint32_t SLOTS_PER_COMPONENT = 4096;
+
+    /**
+     * First stream of a slot
+     */
+    static int64_t GetStream(Component component, uint32_t slot) {
+        NS_ASSERT_MSG(component < NUM_COMPONENTS, "Unknown RNG stream component");
+        NS_ASSERT_MSG(slot < SLOTS_PER_COMPONENT, "RNG stream slot " << slot << " out of range");
+        return (static_cast<int64_t>(component) * SLOTS_PER_COMPONENT + slot) * SLOT_SIZE;
+    }
+
+    /**
+     * Run an ns-3 style AssignStreams call on a slot's first stream
+     *
+     * @param assign Called with the first stream; returns the number of streams used
+     * @return Number of streams used (at most SLOT_SIZE)
+     */
+    static int64_t Assign(Component component, uint32_t slot, const std::function<int64_t(int64_t)>& assign) {
+        int64_t used = assign(GetStream(component, slot));
+        NS_ASSERT_MSG(used <= SLOT_SIZE, "RNG stream slot overflow: " << used << " > " << SLOT_SIZE);
+        return used;
+    }
+};
+
+} // namespace ns3
+
+#endif // RNG_STREAM_PLAN_H
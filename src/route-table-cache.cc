@@ -0,0 +1,224 @@
+/**
+ * Route Table Cache Implementation
+ *
+ * Every read from the mapped file is bounds-checked against the file size; a
+ * truncated or foreign file is treated as a cache miss, never trusted.
+ */
+
+#include "route-table-cache.h"
+#include "ns3/log.h"
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <iomanip>
+#include <sstream>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("IslRouteTableCache");
+
+namespace {
+
+const char MAGIC[8] = {'I', 'S', 'L', 'R', 'T', 'C', '0', '1'};
+const uint32_t KIND_FULL = 0;
+const uint32_t KIND_DELTA = 1;
+
+uint64_t Fnv1a(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+size_t Padded(size_t size) {
+    return (size + 3) & ~static_cast<size_t>(3);
+}
+
+void WritePadding(std::ofstream& out, size_t size) {
+    static const char zeros[4] = {0, 0, 0, 0};
+    out.write(zeros, Padded(size) - size);
+}
+
+} // namespace
+
+IslRouteTableCache::IslRouteTableCache(const std::string& directory)
+    : m_directory(directory),
+      m_lastFileBytes(0) {
+}
+
+uint64_t IslRouteTableCache::ComputeKey(const IslTopology& topology, const std::vector<double>& parameters) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = Fnv1a(hash, &topology.numSatellites, sizeof(topology.numSatellites));
+    for (const auto& [sat, neighbors] : topology.neighbors) {
+        hash = Fnv1a(hash, &sat, sizeof(sat));
+        hash = Fnv1a(hash, neighbors.data(), neighbors.size() * sizeof(uint32_t));
+    }
+    for (const auto& [a, b] : topology.links) {
+        hash = Fnv1a(hash, &a, sizeof(a));
+        hash = Fnv1a(hash, &b, sizeof(b));
+    }
+    hash = Fnv1a(hash, parameters.data(), parameters.size() * sizeof(double));
+    return hash;
+}
+
+std::string IslRouteTableCache::GetPath(uint64_t key) const {
+    std::ostringstream path;
+    path << m_directory << "/isl-routes-" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return path.str();
+}
+
+bool IslRouteTableCache::Load(uint64_t key, uint32_t numSatellites, uint32_t count,
+                              std::vector<std::shared_ptr<const IslNextHopTable>>& tables) const {
+    const std::string path = GetPath(key);
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < 24) {
+        close(fd);
+        return false;
+    }
+    const size_t size = static_cast<size_t>(st.st_size);
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        NS_LOG_WARN("Cannot mmap route cache " << path);
+        return false;
+    }
+
+    const uint8_t* base = static_cast<const uint8_t*>(mapped);
+    size_t offset = 0;
+    auto readU32 = [&](uint32_t& value) {
+        if (offset + 4 > size) return false;
+        std::memcpy(&value, base + offset, 4);
+        offset += 4;
+        return true;
+    };
+
+    bool ok = std::memcmp(base, MAGIC, sizeof(MAGIC)) == 0;
+    uint64_t storedKey = 0;
+    uint32_t storedV = 0;
+    uint32_t stored = 0;
+    if (ok) {
+        std::memcpy(&storedKey, base + 8, 8);
+        offset = 16;
+        ok = readU32(storedV) && readU32(stored) &&
+             storedKey == key && storedV == numSatellites && stored >= count;
+    }
+
+    std::vector<std::shared_ptr<const IslNextHopTable>> loaded;
+    const size_t cells = static_cast<size_t>(numSatellites) * numSatellites;
+    std::shared_ptr<IslNextHopTable> current;
+    for (uint32_t k = 0; ok && k < count; ++k) {
+        uint32_t kind = 0;
+        uint32_t n = 0;
+        if (!readU32(kind) || !readU32(n)) { ok = false; break; }
+
+        if (kind == KIND_FULL) {
+            if (n != cells || offset + Padded(cells) > size) { ok = false; break; }
+            current = std::make_shared<IslNextHopTable>(numSatellites);
+            std::memcpy(current->GetData(), base + offset, cells);
+            offset += Padded(cells);
+        } else if (kind == KIND_DELTA && current) {
+            size_t payload = static_cast<size_t>(n) * 4 + n;
+            if (offset + Padded(payload) > size) { ok = false; break; }
+            current = std::make_shared<IslNextHopTable>(*current);
+            const uint8_t* indices = base + offset;
+            const uint8_t* ports = indices + static_cast<size_t>(n) * 4;
+            uint8_t* data = current->GetData();
+            for (uint32_t i = 0; i < n; ++i) {
+                uint32_t index;
+                std::memcpy(&index, indices + static_cast<size_t>(i) * 4, 4);
+                if (index >= cells) { ok = false; break; }
+                data[index] = ports[i];
+            }
+            offset += Padded(payload);
+        } else {
+            ok = false;
+        }
+        loaded.push_back(current);
+    }
+
+    munmap(mapped, size);
+    if (!ok) {
+        NS_LOG_INFO("Route cache miss: " << path);
+        return false;
+    }
+
+    tables = std::move(loaded);
+    m_lastFileBytes = size;
+    NS_LOG_INFO("Loaded " << count << " route tables from " << path << " (" << size << " bytes)");
+    return true;
+}
+
+bool IslRouteTableCache::Store(uint64_t key, const std::vector<std::shared_ptr<const IslNextHopTable>>& tables) const {
+    if (tables.empty()) return false;
+
+    mkdir(m_directory.c_str(), 0755);  // Existing directory is fine
+    const std::string path = GetPath(key);
+    const std::string tmpPath = path + ".tmp." + std::to_string(getpid());
+
+    std::ofstream out(tmpPath, std::ios::binary);
+    if (!out) {
+        NS_LOG_WARN("Cannot write route cache " << tmpPath);
+        return false;
+    }
+
+    const uint32_t V = tables.front()->GetNumSatellites();
+    const uint32_t count = tables.size();
+    out.write(MAGIC, sizeof(MAGIC));
+    out.write(reinterpret_cast<const char*>(&key), sizeof(key));
+    out.write(reinterpret_cast<const char*>(&V), sizeof(V));
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+    const size_t cells = static_cast<size_t>(V) * V;
+    std::vector<uint32_t> indices;
+    std::vector<uint8_t> ports;
+    for (uint32_t k = 0; k < count; ++k) {
+        const uint8_t* data = tables[k]->GetData();
+        if (k == 0) {
+            uint32_t n = cells;
+            out.write(reinterpret_cast<const char*>(&KIND_FULL), 4);
+            out.write(reinterpret_cast<const char*>(&n), 4);
+            out.write(reinterpret_cast<const char*>(data), cells);
+            WritePadding(out, cells);
+            continue;
+        }
+
+        const uint8_t* previous = tables[k - 1]->GetData();
+        indices.clear();
+        ports.clear();
+        for (size_t i = 0; i < cells; ++i) {
+            if (data[i] != previous[i]) {
+                indices.push_back(static_cast<uint32_t>(i));
+                ports.push_back(data[i]);
+            }
+        }
+        uint32_t n = indices.size();
+        out.write(reinterpret_cast<const char*>(&KIND_DELTA), 4);
+        out.write(reinterpret_cast<const char*>(&n), 4);
+        out.write(reinterpret_cast<const char*>(indices.data()), indices.size() * 4);
+        out.write(reinterpret_cast<const char*>(ports.data()), ports.size());
+        WritePadding(out, indices.size() * 4 + ports.size());
+    }
+
+    m_lastFileBytes = static_cast<uint64_t>(out.tellp());
+    out.close();
+    if (!out || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        NS_LOG_WARN("Cannot write route cache " << path);
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+
+    NS_LOG_INFO("Stored " << count << " route tables in " << path << " (" << m_lastFileBytes
+        << " bytes, " << cells * count << " bytes uncompressed)");
+    return true;
+}
+
+} // namespace ns3
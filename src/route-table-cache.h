@@ -0,0 +1,82 @@
+/**
+ * Route Table Cache
+ *
+ * Purpose: Persist precomputed ISL next-hop table sequences across runs
+ * Features:
+ * - One file per key (hash of the ISL topology and the parameters that determine
+ *   the tables), e.g. shared by all seeds of the same constellation
+ * - First table stored in full (V² bytes), each later one as a delta against its
+ *   predecessor: only changed (index, ports) entries, so size scales with churn
+ * - Loaded with mmap (no parse buffer); written to a temporary file and renamed
+ *   into place so concurrent runs never see a partial file
+ *
+ * File layout (native byte order, all fields 4-byte aligned):
+ *   header   : magic "ISLRTC01", uint64 key, uint32 V, uint32 snapshots
+ *   snapshot : uint32 kind (0 = full, 1 = delta), uint32 n,
+ *              full  → V² port bytes
+ *              delta → n × uint32 index, then n port bytes
+ *              (payload zero-padded to a multiple of 4)
+ *
+ * Usage:
+ *   IslRouteTableCache cache("cache/routes");
+ *   uint64_t key = IslRouteTableCache::ComputeKey(topology, {interval, maxLat, ...});
+ *   if (!cache.Load(key, V, needed, tables)) { ... compute ...; cache.Store(key, tables); }
+ */
+
+#ifndef ROUTE_TABLE_CACHE_H
+#define ROUTE_TABLE_CACHE_H
+
+#include "isl-topology-generator.h"
+#include "static-isl-routing.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+class IslRouteTableCache {
+public:
+    /**
+     * @param directory Cache directory (created on first Store)
+     */
+    explicit IslRouteTableCache(const std::string& directory);
+
+    /**
+     * 64-bit FNV-1a over the topology (satellites, neighbor lists, links) and parameters
+     */
+    static uint64_t ComputeKey(const IslTopology& topology, const std::vector<double>& parameters);
+
+    /**
+     * Load the first count tables stored under key
+     *
+     * @param key Cache key
+     * @param numSatellites Expected V (mismatch = miss)
+     * @param count Number of tables needed
+     * @param tables Output (replaced on success)
+     * @return false on miss: no file, fewer than count tables, or a malformed file
+     */
+    bool Load(uint64_t key, uint32_t numSatellites, uint32_t count,
+              std::vector<std::shared_ptr<const IslNextHopTable>>& tables) const;
+
+    /**
+     * Store a table sequence under key (replaces an existing file)
+     * @return false if the file cannot be written
+     */
+    bool Store(uint64_t key, const std::vector<std::shared_ptr<const IslNextHopTable>>& tables) const;
+
+    std::string GetPath(uint64_t key) const;
+
+    /**
+     * Size of the last file loaded or stored (bytes)
+     */
+    uint64_t GetLastFileBytes() const { return m_lastFileBytes; }
+
+private:
+    std::string m_directory;
+    mutable uint64_t m_lastFileBytes;
+};
+
+} // namespace ns3
+
+#endif // ROUTE_TABLE_CACHE_H
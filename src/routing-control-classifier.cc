@@ -0,0 +1,47 @@
+/**
+ * Routing Control Classifier Implementation
+ */
+
+#include "routing-control-classifier.h"
+#include "isl-source-route-header.h"
+
+namespace ns3 {
+
+namespace {
+const uint8_t IP_PROTOCOL_UDP = 17;
+const uint16_t OLSR_PORT = 698;
+const uint16_t AODV_PORT = 654;
+const uint16_t DSDV_PORT = 269;
+
+bool IsRoutingPort(uint16_t port) {
+    return port == OLSR_PORT || port == AODV_PORT || port == DSDV_PORT;
+}
+}
+
+bool RoutingControlClassifier::IsRoutingControl(const Ipv4Header& header, Ptr<const Packet> payload) {
+    UdpHeader udp;
+    if (!PeekUdpHeader(header, payload, udp)) {
+        return false;
+    }
+    return IsRoutingPort(udp.GetDestinationPort()) || IsRoutingPort(udp.GetSourcePort());
+}
+
+bool RoutingControlClassifier::PeekUdpHeader(const Ipv4Header& header, Ptr<const Packet> payload, UdpHeader& udp) {
+    if (header.GetFragmentOffset() != 0) {
+        return false;  // Starts inside the payload
+    }
+    if (header.GetProtocol() == IslSourceRouteHeader::PROT_NUMBER) {
+        Ptr<Packet> copy = payload->Copy();
+        IslSourceRouteHeader path;
+        if (copy->RemoveHeader(path) == 0 || path.GetProtocol() != IP_PROTOCOL_UDP) {
+            return false;
+        }
+        return copy->PeekHeader(udp) != 0;
+    }
+    if (header.GetProtocol() != IP_PROTOCOL_UDP) {
+        return false;
+    }
+    return payload->PeekHeader(udp) != 0;
+}
+
+} // namespace ns3
@@ -0,0 +1,51 @@
+/**
+ * Routing Control Classifier
+ *
+ * Purpose: Tell routing protocol messages from other IPv4 packets
+ * Features:
+ * - Routing protocol message: UDP to or from the OLSR (698), AODV (654) or
+ *   DSDV (269) port
+ * - Works on an IPv4 header plus IP payload, so any layer can use it: the ISL
+ *   queue disc (control band), the ground EDCA mapping (control AC) and the
+ *   PacketTracer data/control split share it
+ * - Looks past an IslSourceRouteHeader (protocol 253) to the original protocol and
+ *   UDP header; fragments after the first carry no transport header and never match
+ *
+ * Usage:
+ *   if (RoutingControlClassifier::IsRoutingControl(ipItem->GetHeader(), ipItem->GetPacket())) ...
+ */
+
+#ifndef ROUTING_CONTROL_CLASSIFIER_H
+#define ROUTING_CONTROL_CLASSIFIER_H
+
+#include "ns3/ipv4-header.h"
+#include "ns3/packet.h"
+#include "ns3/ptr.h"
+#include "ns3/udp-header.h"
+
+namespace ns3 {
+
+class RoutingControlClassifier {
+public:
+    /**
+     * Routing protocol message (UDP to or from the OLSR, AODV or DSDV port)?
+     *
+     * @param header IPv4 header
+     * @param payload IP payload (starting with the transport header)
+     */
+    static bool IsRoutingControl(const Ipv4Header& header, Ptr<const Packet> payload);
+
+    /**
+     * UDP header of a packet, also behind an ISL source route
+     *
+     * @param header IPv4 header
+     * @param payload IP payload
+     * @param udp Set to the UDP header if found
+     * @return false if the packet is not UDP (or not the first fragment)
+     */
+    static bool PeekUdpHeader(const Ipv4Header& header, Ptr<const Packet> payload, UdpHeader& udp);
+};
+
+} // namespace ns3
+
+#endif // ROUTING_CONTROL_CLASSIFIER_H
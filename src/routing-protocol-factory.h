@@ -2,7 +2,7 @@
  * Phase 4 Week 21: Routing Protocol Factory
  *
  * Factory for creating routing protocol instances by name.
- * Supports protocol creation by name (e.g., "aodv", "olsr", "static").
+ * Supports protocol creation by name (e.g., "aodv", "olsr", "static", "hwmp", "geometric").
  *
  * Usage:
  *   auto protocol = RoutingProtocolFactory::Create("olsr");
@@ -18,6 +18,8 @@
 #include "olsr-routing-protocol.h"
 #include "aodv-routing-protocol.h"
 #include "dsdv-routing-protocol.h"
+#include "hwmp-routing-protocol.h"
+#include "geometric-routing-protocol.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -41,6 +43,8 @@ public:
      * - "olsr" -> OlsrRoutingProtocol (ISL or ground)
      * - "aodv" -> AodvRoutingProtocol (ground only)
      * - "dsdv" -> DsdvRoutingProtocol (ground only)
+     * - "hwmp" -> HwmpRoutingProtocol (ground only, layer-2 802.11s mesh)
+     * - "geometric" -> GeometricRoutingProtocol (ISL only, stateless +Grid forwarding)
      *
      * @param name Protocol name (case-insensitive)
      * @return Unique pointer to protocol instance
@@ -58,6 +62,10 @@ public:
             return std::make_unique<AodvRoutingProtocol>();
         } else if (name == "dsdv") {
             return std::make_unique<DsdvRoutingProtocol>();
+        } else if (name == "hwmp") {
+            return std::make_unique<HwmpRoutingProtocol>();
+        } else if (name == "geometric") {
+            return std::make_unique<GeometricRoutingProtocol>();
         } else {
             throw std::invalid_argument("Unknown protocol: " + name);
         }
@@ -69,7 +77,7 @@ public:
      * @return Vector of protocol names (lowercase)
      */
     static std::vector<std::string> GetSupportedProtocols() {
-        return {"static", "olsr", "aodv", "dsdv"};
+        return {"static", "olsr", "aodv", "dsdv", "hwmp", "geometric"};
     }
 };
 
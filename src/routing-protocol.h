@@ -101,6 +101,20 @@ public:
      * @return Configuration string
      */
     virtual std::string GetConfig() const = 0;
+
+    /**
+     * Assign fixed RNG streams to the internet stack and protocol on nodes.
+     *
+     * Must be called after Install(). Covers protocol jitter (HELLO/update timers)
+     * and stack randomness (ARP request jitter), so runs with fixed streams draw
+     * the same values for everything else whichever protocol is installed.
+     * Protocols without randomness keep the default (no streams used).
+     *
+     * @param nodes Nodes the protocol was installed on
+     * @param stream First stream number
+     * @return Number of streams used
+     */
+    virtual int64_t AssignStreams(NodeContainer nodes, int64_t stream) { return 0; }
 };
 
 } // namespace ns3
@@ -0,0 +1,163 @@
+/**
+ * Run Monitor - Live View of Running Simulations
+ *
+ * Reads the status blocks that unified-simulation publishes with --telemetry
+ * (RunTelemetry) and shows all runs of a sweep at once: progress, events/s,
+ * simulated seconds per wall second, RSS and current PDR/NRL.
+ *
+ * Runs are flagged:
+ * - STALLED: no update for --stall seconds and, in watch mode, no new events since
+ *   the previous refresh (runs publish on a wall-clock cadence however slow the
+ *   simulation is, so a stale heartbeat means the event loop stopped advancing)
+ * - SLOW: simulated time advancing below --min-rate sim s per wall s
+ *   (e.g. an event storm from a diverging protocol)
+ * - DEAD: the process is gone but left its block (crash)
+ * With --kill, STALLED and SLOW runs are sent SIGTERM so the driver can move on;
+ * --clean removes the blocks of DEAD runs.
+ *
+ * Usage:
+ *   ./build/unified-simulation --telemetry=/dev/shm/dymen ... &
+ *   ./build/run-monitor --dir=/dev/shm/dymen --watch=true --interval=2
+ *   ./build/run-monitor --dir=/dev/shm/dymen --stall=60 --kill=true --clean=true
+ */
+
+#include "ns3/core-module.h"
+#include "run-telemetry.h"
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <unistd.h>
+
+using namespace ns3;
+
+namespace {
+
+bool ProcessAlive(int32_t pid) {
+    return kill(pid, 0) == 0 || errno != ESRCH;
+}
+
+double Now() {
+    return std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Print one table of all runs; apply --kill / --clean
+ *
+ * @param lastEvents Event count per PID at the previous refresh (updated)
+ * @return Number of runs still active
+ */
+uint32_t Scan(const std::string& dir, double stall, double minRate, bool killFlagged, bool clean,
+              std::map<int32_t, uint64_t>& lastEvents) {
+    std::cout << std::left << std::setw(8) << "PID" << std::setw(28) << "RUN" << std::right
+              << std::setw(16) << "SIM TIME" << std::setw(7) << "%" << std::setw(12) << "EVENTS"
+              << std::setw(11) << "EV/S" << std::setw(9) << "SIM/S" << std::setw(9) << "RSS MB"
+              << std::setw(8) << "PDR" << std::setw(8) << "NRL" << std::setw(7) << "AGE" << "  STATUS\n";
+
+    uint32_t active = 0;
+    const double now = Now();
+    for (const std::string& path : RunTelemetry::List(dir)) {
+        RunStatusBlock status;
+        if (!RunTelemetry::Read(path, status)) continue;  // Vanished or not yet initialised
+
+        const double age = now - status.heartbeat;
+        auto previous = lastEvents.find(status.pid);
+        const bool eventsRising = previous != lastEvents.end() && status.events > previous->second;
+        lastEvents[status.pid] = status.events;
+        std::string state = status.state == RunStatusBlock::DONE ? "done"
+                          : status.state == RunStatusBlock::STARTING ? "starting" : "running";
+        bool flagged = false;
+        if (status.state != RunStatusBlock::DONE) {
+            if (!ProcessAlive(status.pid)) {
+                state = "DEAD";
+            } else {
+                if (stall > 0.0 && age > stall && !eventsRising) {
+                    state = "STALLED";
+                    flagged = true;
+                } else if (minRate > 0.0 && status.state == RunStatusBlock::RUNNING && status.simRate < minRate) {
+                    state = "SLOW";
+                    flagged = true;
+                }
+                active += !(flagged && killFlagged);
+            }
+        }
+
+        std::ostringstream simTime;
+        simTime << std::fixed << std::setprecision(1) << status.simTime << "/" << status.simStop;
+        double progress = status.simStop > 0.0 ? 100.0 * status.simTime / status.simStop : 0.0;
+        std::cout << std::left << std::setw(8) << status.pid << std::setw(28) << std::string(status.label).substr(0, 27)
+                  << std::right << std::setw(16) << simTime.str()
+                  << std::fixed << std::setprecision(1) << std::setw(7) << progress
+                  << std::setw(12) << status.events
+                  << std::setprecision(0) << std::setw(11) << status.eventsPerSecond
+                  << std::setprecision(2) << std::setw(9) << status.simRate
+                  << std::setprecision(1) << std::setw(9) << status.rssBytes / 1048576.0;
+        if (status.pdr >= 0.0) {
+            std::cout << std::setw(8) << status.pdr;
+        } else {
+            std::cout << std::setw(8) << "-";
+        }
+        if (status.nrl >= 0.0) {
+            std::cout << std::setprecision(3) << std::setw(8) << status.nrl;
+        } else {
+            std::cout << std::setw(8) << "-";
+        }
+        std::cout << std::setprecision(0) << std::setw(7) << age << "  " << state << "\n";
+        std::cout.unsetf(std::ios_base::floatfield);
+
+        if (flagged && killFlagged) {
+            std::cout << "  → SIGTERM to " << status.pid << "\n";
+            kill(status.pid, SIGTERM);
+        }
+        if (state == "DEAD" && clean) {
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+        }
+    }
+    return active;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string dir = "/tmp/dymen-telemetry";
+    bool watch = false;
+    double interval = 2.0;
+    double stall = 30.0;
+    double minRate = 0.0;
+    bool killFlagged = false;
+    bool clean = false;
+
+    CommandLine cmd;
+    cmd.AddValue("dir", "Telemetry directory (as passed to unified-simulation --telemetry)", dir);
+    cmd.AddValue("watch", "Keep refreshing until no run is active", watch);
+    cmd.AddValue("interval", "Refresh interval in watch mode (wall-clock seconds)", interval);
+    cmd.AddValue("stall", "Flag runs without an update for this long (wall-clock seconds, 0 = off)", stall);
+    cmd.AddValue("min-rate", "Flag runs advancing slower than this (simulated s per wall s, 0 = off)", minRate);
+    cmd.AddValue("kill", "Send SIGTERM to flagged (stalled/slow) runs", killFlagged);
+    cmd.AddValue("clean", "Remove status blocks left by crashed runs", clean);
+    cmd.Parse(argc, argv);
+
+    if (!std::filesystem::is_directory(dir)) {
+        std::cerr << "ERROR: Telemetry directory not found: " << dir << "\n";
+        return 1;
+    }
+    if (watch && interval <= 0.0) {
+        std::cerr << "ERROR: --interval must be positive\n";
+        return 1;
+    }
+
+    std::map<int32_t, uint64_t> lastEvents;
+    uint32_t active = Scan(dir, stall, minRate, killFlagged, clean, lastEvents);
+    while (watch && active > 0) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(interval));
+        std::cout << "\n";
+        active = Scan(dir, stall, minRate, killFlagged, clean, lastEvents);
+    }
+    return 0;
+}
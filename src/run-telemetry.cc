@@ -0,0 +1,242 @@
+/**
+ * Run Telemetry Implementation
+ *
+ * The status block is written in place with a seqlock (sequence odd while
+ * writing). Readers copy the fields and accept the copy only if the sequence was
+ * even and unchanged, so a monitor never shows a half-written update and the
+ * simulation never waits for a monitor.
+ */
+
+#include "run-telemetry.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <new>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("RunTelemetry");
+
+namespace {
+const uint32_t READ_ATTEMPTS = 100;
+const uint32_t CHECKS_PER_INTERVAL = 4;
+const char STATUS_PREFIX[] = "run-";
+const char STATUS_SUFFIX[] = ".status";
+}
+
+RunTelemetry::RunTelemetry()
+    : m_block(nullptr),
+      m_lastCheckWall(0.0),
+      m_lastCheckSim(0.0),
+      m_wallInterval(1.0),
+      m_wallStart(0.0),
+      m_lastWall(0.0),
+      m_lastSim(0.0),
+      m_lastEvents(0) {
+}
+
+RunTelemetry::~RunTelemetry() {
+    if (m_block) {
+        munmap(m_block, sizeof(RunStatusBlock));
+        unlink(m_path.c_str());
+    }
+}
+
+bool RunTelemetry::Open(const std::string& dir, const std::string& label, double simStop) {
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    m_path = dir + "/" + STATUS_PREFIX + std::to_string(getpid()) + STATUS_SUFFIX;
+
+    int fd = open(m_path.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if (fd < 0) {
+        NS_LOG_WARN("Cannot create telemetry file " << m_path);
+        return false;
+    }
+    if (ftruncate(fd, sizeof(RunStatusBlock)) != 0) {
+        NS_LOG_WARN("Cannot size telemetry file " << m_path);
+        close(fd);
+        unlink(m_path.c_str());
+        return false;
+    }
+    void* mapped = mmap(nullptr, sizeof(RunStatusBlock), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        NS_LOG_WARN("Cannot mmap telemetry file " << m_path);
+        unlink(m_path.c_str());
+        return false;
+    }
+
+    m_block = new (mapped) RunStatusBlock();
+    m_block->version = RunStatusBlock::VERSION;
+    m_block->pid = getpid();
+    m_block->simStop = simStop;
+    m_block->pdr = -1.0;
+    m_block->nrl = -1.0;
+    std::snprintf(m_block->label, sizeof(m_block->label), "%s", label.c_str());
+    m_wallStart = m_lastWall = WallClock();
+    Publish(RunStatusBlock::STARTING);
+    m_block->magic = RunStatusBlock::MAGIC;  // Valid for readers from here on
+    return true;
+}
+
+void RunTelemetry::SetMetrics(std::function<std::pair<double, double>()> metrics) {
+    m_metrics = std::move(metrics);
+}
+
+void RunTelemetry::Start(Time checkStep, double wallInterval) {
+    if (!m_block) return;
+    m_checkStep = checkStep;
+    m_step = checkStep;
+    m_wallInterval = wallInterval;
+    m_lastCheckWall = WallClock();
+    m_lastCheckSim = Simulator::Now().GetSeconds();
+    Simulator::Schedule(m_step, &RunTelemetry::Check, this);
+}
+
+void RunTelemetry::Finish() {
+    if (m_block) {
+        Publish(RunStatusBlock::DONE);
+    }
+}
+
+void RunTelemetry::Check() {
+    const double wall = WallClock();
+    const double sim = Simulator::Now().GetSeconds();
+    if (wall - m_lastWall >= m_wallInterval) {
+        Publish(RunStatusBlock::RUNNING);
+    }
+
+    // Next check a fraction of the wall-clock interval ahead at the speed just measured;
+    // the step shrinks at once when the run slows down and at most doubles per check
+    double step = std::min(m_checkStep.GetSeconds(), 2.0 * m_step.GetSeconds());
+    if (wall > m_lastCheckWall) {
+        step = std::min(step, (sim - m_lastCheckSim) / (wall - m_lastCheckWall) * m_wallInterval / CHECKS_PER_INTERVAL);
+    }
+    m_step = std::max(Seconds(step), TimeStep(1));
+    m_lastCheckWall = wall;
+    m_lastCheckSim = sim;
+    Simulator::Schedule(m_step, &RunTelemetry::Check, this);
+}
+
+void RunTelemetry::Publish(uint32_t state) {
+    const double wall = WallClock();
+    const double sim = Simulator::Now().GetSeconds();
+    const uint64_t events = Simulator::GetEventCount();
+    const double dt = wall - m_lastWall;
+    std::pair<double, double> metrics(-1.0, -1.0);
+    if (m_metrics && state != RunStatusBlock::STARTING) {
+        metrics = m_metrics();
+    }
+
+    uint32_t seq = m_block->sequence.load(std::memory_order_relaxed);
+    m_block->sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    m_block->state = state;
+    m_block->simTime = sim;
+    m_block->wallTime = wall - m_wallStart;
+    m_block->heartbeat = wall;
+    if (dt > 0.0) {
+        m_block->eventsPerSecond = (events - m_lastEvents) / dt;
+        m_block->simRate = (sim - m_lastSim) / dt;
+    }
+    m_block->events = events;
+    m_block->rssBytes = GetRss();
+    m_block->pdr = metrics.first;
+    m_block->nrl = metrics.second;
+
+    m_block->sequence.store(seq + 2, std::memory_order_release);
+
+    m_lastWall = wall;
+    m_lastSim = sim;
+    m_lastEvents = events;
+}
+
+bool RunTelemetry::Read(const std::string& path, RunStatusBlock& status) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    void* mapped = mmap(nullptr, sizeof(RunStatusBlock), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) return false;
+
+    const RunStatusBlock* block = static_cast<const RunStatusBlock*>(mapped);
+    bool ok = false;
+    for (uint32_t attempt = 0; attempt < READ_ATTEMPTS && !ok; ++attempt) {
+        uint32_t before = block->sequence.load(std::memory_order_acquire);
+        if (before & 1u) continue;  // Update in progress
+
+        status.magic = block->magic;
+        status.version = block->version;
+        status.pid = block->pid;
+        status.state = block->state;
+        status.simTime = block->simTime;
+        status.simStop = block->simStop;
+        status.wallTime = block->wallTime;
+        status.heartbeat = block->heartbeat;
+        status.eventsPerSecond = block->eventsPerSecond;
+        status.simRate = block->simRate;
+        status.events = block->events;
+        status.rssBytes = block->rssBytes;
+        status.pdr = block->pdr;
+        status.nrl = block->nrl;
+        std::memcpy(status.label, block->label, sizeof(status.label));
+        status.label[sizeof(status.label) - 1] = '\0';
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        ok = block->sequence.load(std::memory_order_relaxed) == before;
+        status.sequence.store(before, std::memory_order_relaxed);
+    }
+    munmap(mapped, sizeof(RunStatusBlock));
+    return ok && status.magic == RunStatusBlock::MAGIC && status.version == RunStatusBlock::VERSION;
+}
+
+std::vector<std::string> RunTelemetry::List(const std::string& dir) {
+    std::vector<std::string> paths;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (name.rfind(STATUS_PREFIX, 0) == 0 && name.size() > sizeof(STATUS_SUFFIX) - 1 &&
+            name.compare(name.size() - (sizeof(STATUS_SUFFIX) - 1), std::string::npos, STATUS_SUFFIX) == 0) {
+            paths.push_back(entry.path().string());
+        }
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+uint64_t RunTelemetry::GetRss() {
+#ifdef __linux__
+    // Current resident pages (second field of statm)
+    if (FILE* statm = std::fopen("/proc/self/statm", "r")) {
+        unsigned long size = 0;
+        unsigned long resident = 0;
+        int fields = std::fscanf(statm, "%lu %lu", &size, &resident);
+        std::fclose(statm);
+        if (fields == 2) {
+            return static_cast<uint64_t>(resident) * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        }
+    }
+#endif
+    // Peak RSS (bytes on macOS, KiB elsewhere)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+double RunTelemetry::WallClock() {
+    return std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace ns3
@@ -0,0 +1,151 @@
+/**
+ * Run Telemetry
+ *
+ * Purpose: Live status of a running simulation for the sweep driver and run-monitor
+ * Features:
+ * - Fixed-layout status block (RunStatusBlock) in a memory-mapped file, one per run
+ *   (<dir>/run-<pid>.status); on Linux use /dev/shm for a RAM-only segment
+ * - Simulated time, events processed, events/s, simulated s per wall s, RSS and
+ *   current PDR/NRL, republished at a wall-clock interval
+ * - Seqlock: the writer never blocks, readers retry if they catch a partial update
+ * - Heartbeat (wall clock of the last update) lets a monitor spot stalled runs;
+ *   runs that crash leave their block behind with a dead PID
+ * - Sampling is a recurring event that publishes once the wall-clock interval has
+ *   passed (no threads, no RNG use). Its simulated-time step follows the measured
+ *   simulation speed so that checks land about four times per wall-clock interval:
+ *   a heavy run that needs minutes of wall time per 100 ms of simulated time still
+ *   publishes on time. Only work at a single simulated instant cannot be interrupted.
+ *
+ * Usage:
+ *   RunTelemetry telemetry;
+ *   if (telemetry.Open("/dev/shm/dymen", "aodv-n20-s3", simTime)) {
+ *       telemetry.SetMetrics([&]() { return std::make_pair(pdr(), nrl()); });
+ *       telemetry.Start(Seconds(0.1), 1.0);
+ *   }
+ *   Simulator::Run();
+ *   telemetry.Finish();
+ *
+ *   // Reader side (run-monitor)
+ *   RunStatusBlock status;
+ *   if (RunTelemetry::Read(path, status)) { ... }
+ */
+
+#ifndef RUN_TELEMETRY_H
+#define RUN_TELEMETRY_H
+
+#include "ns3/nstime.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * Status block layout (shared between processes; append fields only, bump version)
+ */
+struct RunStatusBlock {
+    static const uint32_t MAGIC = 0x544d5944;  // "DYMT"
+    static const uint32_t VERSION = 1;
+    enum State : uint32_t { STARTING = 0, RUNNING = 1, DONE = 2 };
+
+    uint32_t magic;
+    uint32_t version;
+    std::atomic<uint32_t> sequence;  // Seqlock: odd while an update is being written
+    int32_t pid;
+    uint32_t state;
+    uint32_t reserved;
+    double simTime;          // Simulated time (s)
+    double simStop;          // Scheduled end (s)
+    double wallTime;         // Wall time since start (s)
+    double heartbeat;        // Wall clock of this update (s since epoch)
+    double eventsPerSecond;  // Over the last interval
+    double simRate;          // Simulated s per wall s over the last interval
+    uint64_t events;         // Events executed
+    uint64_t rssBytes;       // Resident set size (peak where current is unavailable)
+    double pdr;              // Current PDR (%), −1 if unknown
+    double nrl;              // Current NRL, −1 if unknown
+    char label[64];          // Run description (NUL-terminated)
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Seqlock needs a lock-free counter");
+
+class RunTelemetry {
+public:
+    RunTelemetry();
+    ~RunTelemetry();
+
+    RunTelemetry(const RunTelemetry&) = delete;
+    RunTelemetry& operator=(const RunTelemetry&) = delete;
+
+    /**
+     * Create and map this run's status block in dir
+     *
+     * @param dir Directory for status files (created if missing)
+     * @param label Run description shown by monitors
+     * @param simStop Scheduled end of the run (s)
+     * @return false if the block cannot be created (telemetry stays off)
+     */
+    bool Open(const std::string& dir, const std::string& label, double simStop);
+
+    /**
+     * Source of the current PDR (%) and NRL, evaluated only when publishing
+     */
+    void SetMetrics(std::function<std::pair<double, double>()> metrics);
+
+    /**
+     * Start sampling: check at most every checkStep of simulated time (less when the
+     * simulation is slow), publish once per wallInterval seconds of wall time
+     */
+    void Start(Time checkStep, double wallInterval);
+
+    /**
+     * Publish a final update (state DONE); the block is removed when this object is destroyed
+     */
+    void Finish();
+
+    bool IsOpen() const { return m_block != nullptr; }
+    const std::string& GetPath() const { return m_path; }
+
+    /**
+     * Consistent snapshot of a status file (retries while a write is in progress)
+     *
+     * @return false if the file is missing, not a status block or never stable
+     */
+    static bool Read(const std::string& path, RunStatusBlock& status);
+
+    /**
+     * Status files in dir
+     */
+    static std::vector<std::string> List(const std::string& dir);
+
+private:
+    void Check();
+    void Publish(uint32_t state);
+
+    /**
+     * Current RSS (bytes)
+     */
+    static uint64_t GetRss();
+
+    static double WallClock();
+
+    RunStatusBlock* m_block;
+    std::string m_path;
+    std::function<std::pair<double, double>()> m_metrics;
+    Time m_checkStep;       // Largest simulated step between checks
+    Time m_step;            // Current step (adapted to the simulation speed)
+    double m_lastCheckWall;
+    double m_lastCheckSim;
+    double m_wallInterval;
+    double m_wallStart;
+    double m_lastWall;
+    double m_lastSim;
+    uint64_t m_lastEvents;
+};
+
+} // namespace ns3
+
+#endif // RUN_TELEMETRY_H
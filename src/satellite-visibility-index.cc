@@ -0,0 +1,189 @@
+/**
+ * Satellite Visibility Index Implementation
+ *
+ * The cell search is conservative: the cap angle uses the polar Earth radius (the
+ * lowest terminal) and the highest satellite, plus a margin for the difference
+ * between geodetic and geocentric latitude. Only the exact elevation test decides
+ * visibility.
+ */
+
+#include "satellite-visibility-index.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("SatelliteVisibilityIndex");
+
+namespace {
+const double WGS84_A = 6378137.0;                 // Equatorial radius (m)
+const double WGS84_F = 1.0 / 298.257223563;       // Flattening
+const double WGS84_E2 = WGS84_F * (2.0 - WGS84_F);
+const double WGS84_B = WGS84_A * (1.0 - WGS84_F); // Polar radius (m)
+const double CAP_MARGIN = 0.5 * M_PI / 180.0;     // Covers geodetic vs geocentric latitude (≤ 0.2°)
+
+double Deg2Rad(double deg) { return deg * M_PI / 180.0; }
+}
+
+SatelliteVisibilityIndex::SatelliteVisibilityIndex(double cellSizeDeg)
+    : m_maxRadius(0.0),
+      m_candidates(0) {
+    NS_ASSERT_MSG(cellSizeDeg > 0.0, "Visibility index cell size must be positive");
+    m_latCells = std::max(1u, static_cast<uint32_t>(std::lround(180.0 / cellSizeDeg)));
+    m_lonCells = std::max(1u, static_cast<uint32_t>(std::lround(360.0 / cellSizeDeg)));
+    m_latCell = M_PI / m_latCells;
+    m_lonCell = 2.0 * M_PI / m_lonCells;
+    m_cellStart.assign(m_latCells * m_lonCells + 1, 0);
+}
+
+Vector SatelliteVisibilityIndex::GeodeticToEcef(double latDeg, double lonDeg, double altitude) {
+    double lat = Deg2Rad(latDeg);
+    double lon = Deg2Rad(lonDeg);
+    double sinLat = std::sin(lat);
+    double n = WGS84_A / std::sqrt(1.0 - WGS84_E2 * sinLat * sinLat);  // Prime vertical radius
+    return Vector((n + altitude) * std::cos(lat) * std::cos(lon),
+                  (n + altitude) * std::cos(lat) * std::sin(lon),
+                  (n * (1.0 - WGS84_E2) + altitude) * sinLat);
+}
+
+void SatelliteVisibilityIndex::EciToEcef(const std::vector<Vector>& eci, double t, std::vector<Vector>& ecef,
+                                         double gmst0) {
+    const double theta = gmst0 + EARTH_ROTATION_RATE * t;
+    const double c = std::cos(theta);
+    const double s = std::sin(theta);
+    ecef.resize(eci.size());
+    for (size_t i = 0; i < eci.size(); ++i) {
+        const Vector& p = eci[i];
+        ecef[i] = Vector(c * p.x + s * p.y, -s * p.x + c * p.y, p.z);
+    }
+}
+
+uint32_t SatelliteVisibilityIndex::AddTerminal(double latDeg, double lonDeg, double altitude) {
+    Terminal terminal;
+    terminal.position = GeodeticToEcef(latDeg, lonDeg, altitude);
+    double lat = Deg2Rad(latDeg);
+    double lon = Deg2Rad(lonDeg);
+    terminal.up = Vector(std::cos(lat) * std::cos(lon), std::cos(lat) * std::sin(lon), std::sin(lat));
+    const Vector& p = terminal.position;
+    terminal.lat = std::atan2(p.z, std::sqrt(p.x * p.x + p.y * p.y));
+    terminal.lon = std::atan2(p.y, p.x);
+    m_terminals.push_back(terminal);
+    return m_terminals.size() - 1;
+}
+
+uint32_t SatelliteVisibilityIndex::CellOf(double lat, double lon) const {
+    uint32_t i = std::min(m_latCells - 1, static_cast<uint32_t>((lat + M_PI / 2.0) / m_latCell));
+    uint32_t j = std::min(m_lonCells - 1, static_cast<uint32_t>((lon + M_PI) / m_lonCell));
+    return i * m_lonCells + j;
+}
+
+void SatelliteVisibilityIndex::Update(const std::vector<Vector>& ecef) {
+    m_satellites = ecef;
+    Rebuild();
+}
+
+void SatelliteVisibilityIndex::Update(const WalkerDeltaConstellation& constellation, double t) {
+    m_eciScratch.resize(constellation.GetNumSatellites());
+    for (uint32_t s = 0; s < m_eciScratch.size(); ++s) {
+        m_eciScratch[s] = constellation.GetPosition(s, t);
+    }
+    EciToEcef(m_eciScratch, t, m_satellites);
+    Rebuild();
+}
+
+void SatelliteVisibilityIndex::Rebuild() {
+    const size_t n = m_satellites.size();
+    m_maxRadius = 0.0;
+    m_satCell.resize(n);
+    std::fill(m_cellStart.begin(), m_cellStart.end(), 0);
+    for (size_t s = 0; s < n; ++s) {
+        const Vector& p = m_satellites[s];
+        double horizontal = std::sqrt(p.x * p.x + p.y * p.y);
+        m_maxRadius = std::max(m_maxRadius, std::sqrt(horizontal * horizontal + p.z * p.z));
+        m_satCell[s] = CellOf(std::atan2(p.z, horizontal), std::atan2(p.y, p.x));
+        m_cellStart[m_satCell[s] + 1]++;
+    }
+    for (size_t c = 1; c < m_cellStart.size(); ++c) {
+        m_cellStart[c] += m_cellStart[c - 1];
+    }
+    m_cellSats.resize(n);
+    m_cellNext.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+    for (size_t s = 0; s < n; ++s) {
+        m_cellSats[m_cellNext[m_satCell[s]]++] = s;
+    }
+}
+
+void SatelliteVisibilityIndex::GetVisible(uint32_t terminal, double maskDeg, std::vector<uint32_t>& visible) const {
+    NS_ASSERT_MSG(terminal < m_terminals.size(), "Unknown terminal " << terminal);
+    visible.clear();
+    if (m_satellites.empty()) return;
+
+    const Terminal& term = m_terminals[terminal];
+    const double mask = Deg2Rad(std::max(-90.0, std::min(90.0, maskDeg)));
+    const double sinMask = std::sin(mask);
+    const double sinMask2 = sinMask * sinMask;
+
+    // Coverage cap: central angle between terminal and sub-point at the mask elevation
+    double ratio = std::min(1.0, WGS84_B * std::cos(mask) / m_maxRadius);
+    double cap = std::acos(ratio) - mask + CAP_MARGIN;
+
+    const double latLo = term.lat - cap;
+    const double latHi = term.lat + cap;
+    uint32_t iLo = static_cast<uint32_t>(std::max(0.0, (latLo + M_PI / 2.0) / m_latCell));
+    uint32_t iHi = std::min(m_latCells - 1, static_cast<uint32_t>(std::max(0.0, (latHi + M_PI / 2.0) / m_latCell)));
+
+    // Longitude half-width of the cap (all longitudes if it contains a pole)
+    bool allLon = latLo <= -M_PI / 2.0 || latHi >= M_PI / 2.0 || std::sin(cap) >= std::cos(term.lat);
+    int64_t jLo = 0;
+    int64_t jHi = m_lonCells - 1;
+    if (!allLon) {
+        double halfWidth = std::asin(std::sin(cap) / std::cos(term.lat));
+        jLo = static_cast<int64_t>(std::floor((term.lon - halfWidth + M_PI) / m_lonCell));
+        jHi = static_cast<int64_t>(std::floor((term.lon + halfWidth + M_PI) / m_lonCell));
+        if (jHi - jLo + 1 >= static_cast<int64_t>(m_lonCells)) {
+            jLo = 0;
+            jHi = m_lonCells - 1;
+        }
+    }
+
+    const int64_t lonCells = m_lonCells;
+    const uint32_t jFirst = static_cast<uint32_t>(((jLo % lonCells) + lonCells) % lonCells);
+    const uint32_t jCount = static_cast<uint32_t>(jHi - jLo + 1);
+    for (uint32_t i = iLo; i <= iHi; ++i) {
+        const uint32_t row = i * m_lonCells;
+        for (uint32_t n = 0, jj = jFirst; n < jCount; ++n, jj = (jj + 1 == m_lonCells ? 0 : jj + 1)) {
+            uint32_t c = row + jj;
+            for (uint32_t k = m_cellStart[c]; k < m_cellStart[c + 1]; ++k) {
+                uint32_t s = m_cellSats[k];
+                const Vector& sat = m_satellites[s];
+                double dx = sat.x - term.position.x;
+                double dy = sat.y - term.position.y;
+                double dz = sat.z - term.position.z;
+                double dot = dx * term.up.x + dy * term.up.y + dz * term.up.z;
+                double range2 = dx * dx + dy * dy + dz * dz;
+                m_candidates++;
+                // sin(elevation) = dot / range ≥ sin(mask), compared squared (no sqrt)
+                bool above = sinMask >= 0.0 ? (dot >= 0.0 && dot * dot >= range2 * sinMask2)
+                                            : (dot >= 0.0 || dot * dot <= range2 * sinMask2);
+                if (above) {
+                    visible.push_back(s);
+                }
+            }
+        }
+    }
+    std::sort(visible.begin(), visible.end());
+}
+
+double SatelliteVisibilityIndex::GetElevation(uint32_t terminal, uint32_t sat) const {
+    NS_ASSERT_MSG(terminal < m_terminals.size() && sat < m_satellites.size(), "Unknown terminal or satellite");
+    const Terminal& term = m_terminals[terminal];
+    const Vector& s = m_satellites[sat];
+    Vector d(s.x - term.position.x, s.y - term.position.y, s.z - term.position.z);
+    double range = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+    double dot = d.x * term.up.x + d.y * term.up.y + d.z * term.up.z;
+    return std::asin(std::max(-1.0, std::min(1.0, dot / range))) * 180.0 / M_PI;
+}
+
+} // namespace ns3
@@ -0,0 +1,120 @@
+/**
+ * Satellite Visibility Index
+ *
+ * Purpose: Answer "which satellites are above the elevation mask from here" per tick
+ * Features:
+ * - Satellite sub-points bucketed in a latitude/longitude cell grid, rebuilt per tick
+ *   with one counting sort (cell offsets + satellite IDs, no per-cell allocation)
+ * - Queries probe only cells inside the coverage cap of the mask (central angle
+ *   λ = acos(R cos ε / r) − ε), then test the exact elevation of each candidate
+ * - Batch conversions: ECI → ECEF for all satellites (Earth rotation), WGS-84
+ *   geodetic → ECEF for terminals (done once when terminals are added)
+ * - Elevation is measured from the geodetic horizon of the terminal
+ *
+ * Usage:
+ *   SatelliteVisibilityIndex index;
+ *   uint32_t gw = index.AddTerminal(48.1, 11.6);
+ *   index.Update(constellation, t);
+ *   std::vector<uint32_t> visible;
+ *   index.GetVisible(gw, 25.0, visible);
+ */
+
+#ifndef SATELLITE_VISIBILITY_INDEX_H
+#define SATELLITE_VISIBILITY_INDEX_H
+
+#include "walker-delta-constellation.h"
+#include "ns3/vector.h"
+#include <cstdint>
+#include <vector>
+
+namespace ns3 {
+
+class SatelliteVisibilityIndex {
+public:
+    static constexpr double EARTH_ROTATION_RATE = 7.2921150e-5;  // rad/s
+
+    /**
+     * @param cellSizeDeg Grid cell size (degrees; rounded so cells tile the sphere exactly)
+     */
+    explicit SatelliteVisibilityIndex(double cellSizeDeg = 5.0);
+
+    /**
+     * WGS-84 geodetic coordinates to ECEF (m)
+     */
+    static Vector GeodeticToEcef(double latDeg, double lonDeg, double altitude);
+
+    /**
+     * Rotate ECI positions into ECEF at time t (Greenwich angle gmst0 + ωE·t)
+     */
+    static void EciToEcef(const std::vector<Vector>& eci, double t, std::vector<Vector>& ecef,
+                          double gmst0 = 0.0);
+
+    /**
+     * Add a ground terminal
+     *
+     * @return Terminal ID
+     */
+    uint32_t AddTerminal(double latDeg, double lonDeg, double altitude = 0.0);
+
+    /**
+     * Rebuild the index from ECEF satellite positions
+     */
+    void Update(const std::vector<Vector>& ecef);
+
+    /**
+     * Rebuild the index from a constellation at time t (ECI frame aligned with ECEF at t=0)
+     */
+    void Update(const WalkerDeltaConstellation& constellation, double t);
+
+    /**
+     * Satellites above the elevation mask from a terminal (IDs in ascending order)
+     */
+    void GetVisible(uint32_t terminal, double maskDeg, std::vector<uint32_t>& visible) const;
+
+    /**
+     * Elevation of a satellite from a terminal (degrees)
+     */
+    double GetElevation(uint32_t terminal, uint32_t sat) const;
+
+    uint32_t GetNumTerminals() const { return m_terminals.size(); }
+    uint32_t GetNumSatellites() const { return m_satellites.size(); }
+    uint32_t GetNumCells() const { return m_latCells * m_lonCells; }
+
+    /**
+     * Exact elevation tests performed by all queries so far (index efficiency)
+     */
+    uint64_t GetCandidatesTested() const { return m_candidates; }
+
+private:
+    struct Terminal {
+        Vector position;   // ECEF (m)
+        Vector up;         // Geodetic normal (unit)
+        double lat;        // Geocentric latitude (rad), for the cell search
+        double lon;        // Longitude (rad)
+    };
+
+    uint32_t CellOf(double lat, double lon) const;
+
+    /**
+     * Re-bucket m_satellites (counting sort by sub-point cell)
+     */
+    void Rebuild();
+
+    double m_latCell;           // Radians (π / m_latCells)
+    double m_lonCell;           // Radians (2π / m_lonCells)
+    uint32_t m_latCells;
+    uint32_t m_lonCells;
+    std::vector<Terminal> m_terminals;
+    std::vector<Vector> m_satellites;      // ECEF positions of the current tick
+    std::vector<uint32_t> m_cellStart;     // Cell c holds m_cellSats[m_cellStart[c] .. m_cellStart[c+1])
+    std::vector<uint32_t> m_cellSats;
+    double m_maxRadius;                    // Largest satellite orbit radius this tick
+    std::vector<Vector> m_eciScratch;
+    std::vector<uint32_t> m_satCell;       // Scratch: cell of each satellite
+    std::vector<uint32_t> m_cellNext;      // Scratch: fill position per cell
+    mutable uint64_t m_candidates;
+};
+
+} // namespace ns3
+
+#endif // SATELLITE_VISIBILITY_INDEX_H
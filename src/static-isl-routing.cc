@@ -134,4 +134,306 @@ uint32_t GetHopCount(const RoutingTables& routes, uint32_t src, uint32_t dst) {
     return hops;
 }
 
+// ============================================================================
+// IncrementalIslRoutes
+// ============================================================================
+
+IncrementalIslRoutes::IncrementalIslRoutes(const IslTopology& topology)
+    : m_numSatellites(topology.numSatellites),
+      m_adjacency(topology.numSatellites),
+      m_satUp(topology.numSatellites, true),
+      m_treeRecomputations(0) {
+    const size_t cells = static_cast<size_t>(m_numSatellites) * m_numSatellites;
+    m_dist.assign(cells, UINT32_MAX);
+    m_parent.assign(cells, UINT32_MAX);
+    m_nextHop.assign(cells, UINT32_MAX);
+
+    for (const auto& [sat, neighbors] : topology.neighbors) {
+        if (sat >= m_numSatellites) continue;
+        for (uint32_t neighbor : neighbors) {
+            if (neighbor >= m_numSatellites) continue;
+            auto key = std::make_pair(std::min(sat, neighbor), std::max(sat, neighbor));
+            auto it = m_linkIndex.find(key);
+            if (it == m_linkIndex.end()) {
+                it = m_linkIndex.emplace(key, static_cast<uint32_t>(m_linkUp.size())).first;
+                m_linkUp.push_back(true);
+            }
+            m_adjacency[sat].push_back({neighbor, it->second});
+        }
+    }
+
+    for (uint32_t src = 0; src < m_numSatellites; ++src) {
+        RecomputeSource(src);
+    }
+}
+
+bool IncrementalIslRoutes::IsEdgeUsable(const Edge& edge, uint32_t from) const {
+    return m_linkUp[edge.link] && m_satUp[from] && m_satUp[edge.to];
+}
+
+bool IncrementalIslRoutes::IsLinkUp(uint32_t a, uint32_t b) const {
+    auto it = m_linkIndex.find({std::min(a, b), std::max(a, b)});
+    return it != m_linkIndex.end() && m_linkUp[it->second];
+}
+
+bool IncrementalIslRoutes::RecomputeSource(uint32_t src) {
+    const size_t row = static_cast<size_t>(src) * m_numSatellites;
+    uint32_t* dist = &m_dist[row];
+    uint32_t* parent = &m_parent[row];
+    uint32_t* nextHop = &m_nextHop[row];
+
+    std::vector<uint32_t> oldNextHop(nextHop, nextHop + m_numSatellites);
+    std::fill(dist, dist + m_numSatellites, UINT32_MAX);
+    std::fill(parent, parent + m_numSatellites, UINT32_MAX);
+    std::fill(nextHop, nextHop + m_numSatellites, UINT32_MAX);
+    m_treeRecomputations++;
+
+    if (m_satUp[src]) {
+        // Level-synchronous BFS; each level is visited in ascending ID order so the
+        // first parent found is the one Dijkstra's (dist, node) ordering would pick
+        dist[src] = 0;
+        std::vector<uint32_t> frontier = {src};
+        std::vector<uint32_t> next;
+        while (!frontier.empty()) {
+            std::sort(frontier.begin(), frontier.end());
+            next.clear();
+            for (uint32_t u : frontier) {
+                for (const Edge& edge : m_adjacency[u]) {
+                    uint32_t v = edge.to;
+                    if (dist[v] != UINT32_MAX || !IsEdgeUsable(edge, u)) continue;
+                    dist[v] = dist[u] + 1;
+                    parent[v] = u;
+                    nextHop[v] = (u == src) ? v : nextHop[u];
+                    next.push_back(v);
+                }
+            }
+            frontier.swap(next);
+        }
+    }
+
+    return !std::equal(oldNextHop.begin(), oldNextHop.end(), nextHop);
+}
+
+std::vector<uint32_t> IncrementalIslRoutes::Recompute(const std::vector<uint32_t>& sources) {
+    m_lastRecomputed = sources;
+    std::vector<uint32_t> changed;
+    for (uint32_t src : sources) {
+        if (RecomputeSource(src)) {
+            changed.push_back(src);
+        }
+    }
+    return changed;
+}
+
+void IncrementalIslRoutes::CollectDownAffected(uint32_t a, uint32_t b, std::vector<bool>& affected) const {
+    for (uint32_t src = 0; src < m_numSatellites; ++src) {
+        const size_t row = static_cast<size_t>(src) * m_numSatellites;
+        if (m_parent[row + b] == a || m_parent[row + a] == b) {
+            affected[src] = true;
+        }
+    }
+}
+
+void IncrementalIslRoutes::CollectUpAffected(uint32_t a, uint32_t b, std::vector<bool>& affected) const {
+    for (uint32_t src = 0; src < m_numSatellites; ++src) {
+        const size_t row = static_cast<size_t>(src) * m_numSatellites;
+        uint32_t da = m_dist[row + a];
+        uint32_t db = m_dist[row + b];
+        if (da == UINT32_MAX && db == UINT32_MAX) continue;
+        if (da == UINT32_MAX || db == UINT32_MAX || (da > db ? da - db : db - da) > 1) {
+            affected[src] = true;
+        } else if (db == da + 1 && a < m_parent[row + b]) {
+            affected[src] = true; // Same distance, but a now wins b's lowest-ID tie-break
+        } else if (da == db + 1 && b < m_parent[row + a]) {
+            affected[src] = true;
+        }
+    }
+}
+
+std::vector<uint32_t> IncrementalIslRoutes::SetLinkState(uint32_t a, uint32_t b, bool up) {
+    auto it = m_linkIndex.find({std::min(a, b), std::max(a, b)});
+    if (it == m_linkIndex.end() || m_linkUp[it->second] == up) {
+        m_lastRecomputed.clear();
+        return {};
+    }
+
+    std::vector<bool> affected(m_numSatellites, false);
+    bool endpointsUp = m_satUp[a] && m_satUp[b];
+    if (!up && endpointsUp) {
+        CollectDownAffected(a, b, affected); // Needs the trees before the change
+    }
+    m_linkUp[it->second] = up;
+    if (up && endpointsUp) {
+        CollectUpAffected(a, b, affected);
+    }
+
+    std::vector<uint32_t> sources;
+    for (uint32_t src = 0; src < m_numSatellites; ++src) {
+        if (affected[src]) sources.push_back(src);
+    }
+    return Recompute(sources);
+}
+
+std::vector<uint32_t> IncrementalIslRoutes::SetSatelliteState(uint32_t sat, bool up) {
+    if (sat >= m_numSatellites || m_satUp[sat] == up) {
+        m_lastRecomputed.clear();
+        return {};
+    }
+
+    std::vector<bool> affected(m_numSatellites, false);
+    affected[sat] = true;
+    if (!up) {
+        for (const Edge& edge : m_adjacency[sat]) {
+            if (IsEdgeUsable(edge, sat)) {
+                CollectDownAffected(sat, edge.to, affected);
+            }
+        }
+    }
+    m_satUp[sat] = up;
+    if (up) {
+        for (const Edge& edge : m_adjacency[sat]) {
+            if (IsEdgeUsable(edge, sat)) {
+                CollectUpAffected(sat, edge.to, affected);
+            }
+        }
+    }
+
+    std::vector<uint32_t> sources;
+    for (uint32_t src = 0; src < m_numSatellites; ++src) {
+        if (affected[src]) sources.push_back(src);
+    }
+    return Recompute(sources);
+}
+
+RoutingTables IncrementalIslRoutes::GetRoutingTables() const {
+    RoutingTables routes;
+    for (uint32_t src = 0; src < m_numSatellites; ++src) {
+        for (uint32_t dst = 0; dst < m_numSatellites; ++dst) {
+            uint32_t nextHop = GetNextHop(src, dst);
+            if (src != dst && nextHop != UINT32_MAX) {
+                routes.SetNextHop(src, dst, nextHop);
+            }
+        }
+    }
+    return routes;
+}
+
+void IncrementalIslRoutes::FillRow(IslNextHopTable& table, uint32_t src, bool ecmp) const {
+    const size_t row = static_cast<size_t>(src) * m_numSatellites;
+    const std::vector<Edge>& ports = m_adjacency[src];
+
+    for (uint32_t dst = 0; dst < m_numSatellites; ++dst) {
+        uint8_t mask = 0;
+        uint32_t d = m_dist[row + dst];
+        if (dst != src && d != UINT32_MAX) {
+            for (uint32_t p = 0; p < ports.size() && p < IslNextHopTable::MAX_PORTS; ++p) {
+                if (!IsEdgeUsable(ports[p], src)) continue;
+                uint32_t neighbor = ports[p].to;
+                bool onPath = ecmp
+                    ? m_dist[static_cast<size_t>(neighbor) * m_numSatellites + dst] == d - 1
+                    : m_nextHop[row + dst] == neighbor;
+                if (onPath) {
+                    mask |= static_cast<uint8_t>(1u << p);
+                }
+            }
+        }
+        table.SetPorts(src, dst, mask);
+    }
+}
+
+void IncrementalIslRoutes::FillNextHopTable(IslNextHopTable& table, bool ecmp) const {
+    for (uint32_t src = 0; src < m_numSatellites; ++src) {
+        FillRow(table, src, ecmp);
+    }
+}
+
+void IncrementalIslRoutes::RefreshNextHopTable(IslNextHopTable& table, bool ecmp) const {
+    std::vector<bool> dirty(m_numSatellites, false);
+    for (uint32_t src : m_lastRecomputed) {
+        dirty[src] = true;
+        if (ecmp) {
+            for (const Edge& edge : m_adjacency[src]) {
+                dirty[edge.to] = true;
+            }
+        }
+    }
+    for (uint32_t src = 0; src < m_numSatellites; ++src) {
+        if (dirty[src]) FillRow(table, src, ecmp);
+    }
+}
+
+uint64_t IslNextHopTable::CountMultipathPairs() const {
+    uint64_t count = 0;
+    for (uint8_t ports : m_ports) {
+        if (ports & (ports - 1)) count++; // More than one bit set
+    }
+    return count;
+}
+
+IslNextHopTable ComputeEcmpRoutes(const IslTopology& topology) {
+    IncrementalIslRoutes routes(topology);
+    IslNextHopTable table(topology.numSatellites);
+    routes.FillNextHopTable(table, true);
+    return table;
+}
+
+IslNextHopTable ComputeDelayWeightedRoutes(const IslTopology& topology,
+                                           const std::vector<double>& linkDelay) {
+    const uint32_t V = topology.numSatellites;
+    const double INF = std::numeric_limits<double>::infinity();
+    IslNextHopTable table(V);
+
+    // Weighted adjacency over active links: (neighbor, delay, port of neighbor towards u)
+    std::map<std::pair<uint32_t, uint32_t>, uint32_t> linkIndex;
+    for (uint32_t i = 0; i < topology.links.size(); ++i) {
+        linkIndex[topology.links[i]] = i;
+    }
+    struct Arc { uint32_t to; double delay; uint8_t port; };
+    std::vector<std::vector<Arc>> adjacency(V);
+    for (uint32_t u = 0; u < V; ++u) {
+        auto it = topology.neighbors.find(u);
+        if (it == topology.neighbors.end()) continue;
+        for (uint32_t p = 0; p < it->second.size(); ++p) {
+            uint32_t v = it->second[p];
+            auto link = linkIndex.find({std::min(u, v), std::max(u, v)});
+            if (link == linkIndex.end() || link->second >= linkDelay.size()) continue;
+            double delay = linkDelay[link->second];
+            if (delay < 0.0) continue;
+            // Arc v → u: v forwards through its port towards u, i.e. the port of u in v's list
+            const auto& vNeighbors = topology.neighbors.at(v);
+            uint32_t port = std::find(vNeighbors.begin(), vNeighbors.end(), u) - vNeighbors.begin();
+            adjacency[u].push_back({v, delay, static_cast<uint8_t>(port)});
+        }
+    }
+
+    std::vector<double> dist(V);
+    std::vector<uint32_t> parent(V);
+    using Entry = std::pair<double, uint32_t>;
+    for (uint32_t dst = 0; dst < V; ++dst) {
+        std::fill(dist.begin(), dist.end(), INF);
+        std::fill(parent.begin(), parent.end(), UINT32_MAX);
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+        dist[dst] = 0.0;
+        queue.push({0.0, dst});
+
+        while (!queue.empty()) {
+            auto [d, u] = queue.top();
+            queue.pop();
+            if (d > dist[u]) continue;
+            for (const Arc& arc : adjacency[u]) {
+                double nd = d + arc.delay;
+                if (nd < dist[arc.to] || (nd == dist[arc.to] && u < parent[arc.to])) {
+                    bool improved = nd < dist[arc.to];
+                    dist[arc.to] = nd;
+                    parent[arc.to] = u;
+                    table.SetPorts(arc.to, dst, static_cast<uint8_t>(1u << arc.port));
+                    if (improved) queue.push({nd, arc.to});
+                }
+            }
+        }
+    }
+
+    return table;
+}
+
 } // namespace ns3
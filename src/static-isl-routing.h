@@ -23,6 +23,7 @@
 #include <map>
 #include <vector>
 #include <cstdint>
+#include <cstddef>
 
 namespace ns3 {
 
@@ -92,6 +93,193 @@ RoutingTables ComputeStaticRoutes(const IslTopology& topology);
  */
 uint32_t GetHopCount(const RoutingTables& routes, uint32_t src, uint32_t dst);
 
+/**
+ * Next-hop port table for ISL forwarding (single-path or ECMP)
+ *
+ * ports[src][dst] is a bitmask over src's neighbor list (bit p = topology.neighbors[src][p]),
+ * so one byte holds every equal-cost next hop of a 4-neighbor +Grid (up to 8 ports).
+ * Stored as a flat V×V array: one cache line covers 64 destinations.
+ */
+class IslNextHopTable {
+public:
+    static const uint32_t MAX_PORTS = 8;
+
+    IslNextHopTable() : m_numSatellites(0) {}
+    explicit IslNextHopTable(uint32_t numSatellites)
+        : m_numSatellites(numSatellites),
+          m_ports(static_cast<size_t>(numSatellites) * numSatellites, 0) {}
+
+    uint8_t GetPorts(uint32_t src, uint32_t dst) const {
+        return m_ports[static_cast<size_t>(src) * m_numSatellites + dst];
+    }
+
+    void SetPorts(uint32_t src, uint32_t dst, uint8_t ports) {
+        m_ports[static_cast<size_t>(src) * m_numSatellites + dst] = ports;
+    }
+
+    uint32_t GetNumSatellites() const { return m_numSatellites; }
+
+    /**
+     * Raw row-major V×V port bytes (serialisation, snapshot deltas)
+     */
+    const uint8_t* GetData() const { return m_ports.data(); }
+    uint8_t* GetData() { return m_ports.data(); }
+    size_t GetSize() const { return m_ports.size(); }
+
+    /**
+     * @return Number of (src, dst) pairs with more than one next hop
+     */
+    uint64_t CountMultipathPairs() const;
+
+private:
+    uint32_t m_numSatellites;
+    std::vector<uint8_t> m_ports;
+};
+
+/**
+ * Compute all equal-cost shortest-path next hops (hop-count metric)
+ *
+ * Port p of src is in ports[src][dst] iff dist(neighbor_p, dst) = dist(src, dst) − 1.
+ *
+ * @param topology ISL topology (at most IslNextHopTable::MAX_PORTS neighbors per satellite)
+ * @return ECMP next-hop table
+ */
+IslNextHopTable ComputeEcmpRoutes(const IslTopology& topology);
+
+/**
+ * Compute single-path next hops minimising total link delay
+ *
+ * Runs one Dijkstra per destination over the active links (reverse tree: the
+ * parent of src is its next hop towards dst). Ties go to the lower satellite ID.
+ *
+ * @param topology ISL topology (candidate links)
+ * @param linkDelay Delay (s) per topology.links entry; negative = link inactive
+ * @return Next-hop table (empty row entries for unreachable pairs)
+ */
+IslNextHopTable ComputeDelayWeightedRoutes(const IslTopology& topology,
+                                           const std::vector<double>& linkDelay);
+
+/**
+ * Incrementally repaired static routes for an ISL mesh with failing links/satellites
+ *
+ * Keeps one BFS shortest-path tree per source (flat V×V dist/parent arrays) over the
+ * links that are currently up. A state change only recomputes the trees it can affect:
+ * - Link down (u,v): sources whose tree uses edge u–v (parent[v] = u or parent[u] = v)
+ * - Link up (u,v): sources with |dist(u) − dist(v)| > 1 (the new edge shortens a path),
+ *   or dist(v) = dist(u) + 1 with u < parent[v] (the new edge wins v's tie-break)
+ * - Satellite down/up: all of its links at once
+ *
+ * Tie-breaking matches ComputeStaticRoutes (lowest satellite ID first within a BFS
+ * level), so with all links up the tables are identical to the one-shot computation.
+ *
+ * Usage:
+ *   IncrementalIslRoutes routes(topology);
+ *   std::vector<uint32_t> changed = routes.SetLinkState(3, 11, false);
+ *   for (uint32_t src : changed) { ... reinstall routes of src ... }
+ */
+class IncrementalIslRoutes {
+public:
+    explicit IncrementalIslRoutes(const IslTopology& topology);
+
+    /**
+     * Bring an ISL link down or up.
+     * @return Sources whose next-hop row changed (ascending)
+     */
+    std::vector<uint32_t> SetLinkState(uint32_t a, uint32_t b, bool up);
+
+    /**
+     * Bring a satellite (all of its links) down or up.
+     * Links of a down satellite stay down until the satellite comes back.
+     * @return Sources whose next-hop row changed (ascending)
+     */
+    std::vector<uint32_t> SetSatelliteState(uint32_t sat, bool up);
+
+    /**
+     * @return Next hop from src to dst, or UINT32_MAX if unreachable
+     */
+    uint32_t GetNextHop(uint32_t src, uint32_t dst) const {
+        return m_nextHop[static_cast<size_t>(src) * m_numSatellites + dst];
+    }
+
+    /**
+     * @return Hop distance from src to dst, or UINT32_MAX if unreachable
+     */
+    uint32_t GetDistance(uint32_t src, uint32_t dst) const {
+        return m_dist[static_cast<size_t>(src) * m_numSatellites + dst];
+    }
+
+    bool IsLinkUp(uint32_t a, uint32_t b) const;
+    bool IsSatelliteUp(uint32_t sat) const { return m_satUp[sat]; }
+
+    /**
+     * Snapshot of the current next hops as RoutingTables
+     */
+    RoutingTables GetRoutingTables() const;
+
+    /**
+     * Fill every row of a next-hop port table
+     *
+     * @param table Table sized for this constellation
+     * @param ecmp true: all equal-cost next hops; false: the single tree next hop
+     */
+    void FillNextHopTable(IslNextHopTable& table, bool ecmp) const;
+
+    /**
+     * Refresh the table rows that the last Set*State() call can have changed
+     *
+     * Single path: the recomputed sources. ECMP: the recomputed sources and their
+     * neighbors (an ECMP row depends on the distance rows of the source's neighbors).
+     */
+    void RefreshNextHopTable(IslNextHopTable& table, bool ecmp) const;
+
+    uint32_t GetNumSatellites() const { return m_numSatellites; }
+    uint64_t GetTreeRecomputations() const { return m_treeRecomputations; }
+
+private:
+    struct Edge {
+        uint32_t to;
+        uint32_t link;  // Index into m_linkUp
+    };
+
+    /**
+     * Rebuild the BFS tree and next-hop row of one source.
+     * @return true if the next-hop row changed
+     */
+    bool RecomputeSource(uint32_t src);
+
+    /**
+     * Recompute the given sources and return those whose next-hop row changed.
+     */
+    std::vector<uint32_t> Recompute(const std::vector<uint32_t>& sources);
+
+    /**
+     * Write one row of a next-hop port table.
+     */
+    void FillRow(IslNextHopTable& table, uint32_t src, bool ecmp) const;
+
+    /**
+     * Sources whose tree may change when link (a,b) goes down / up.
+     */
+    void CollectDownAffected(uint32_t a, uint32_t b, std::vector<bool>& affected) const;
+    void CollectUpAffected(uint32_t a, uint32_t b, std::vector<bool>& affected) const;
+
+    /**
+     * Effective link state: link flag and both endpoint satellites up.
+     */
+    bool IsEdgeUsable(const Edge& edge, uint32_t from) const;
+
+    uint32_t m_numSatellites;
+    std::vector<std::vector<Edge>> m_adjacency;          // Neighbor list order of the topology
+    std::map<std::pair<uint32_t, uint32_t>, uint32_t> m_linkIndex; // (a < b) → link index
+    std::vector<bool> m_linkUp;
+    std::vector<bool> m_satUp;
+    std::vector<uint32_t> m_dist;     // [src × V + v] hop distance
+    std::vector<uint32_t> m_parent;   // [src × V + v] BFS tree parent
+    std::vector<uint32_t> m_nextHop;  // [src × V + v] first hop
+    std::vector<uint32_t> m_lastRecomputed; // Sources rebuilt by the last state change
+    uint64_t m_treeRecomputations;
+};
+
 } // namespace ns3
 
 #endif // STATIC_ISL_ROUTING_H
@@ -37,4 +37,10 @@ std::string StaticRoutingProtocol::GetConfig() const {
     return "Static[no_parameters]";
 }
 
+int64_t StaticRoutingProtocol::AssignStreams(NodeContainer nodes, int64_t stream) {
+    // No protocol randomness; only the internet stack (ARP jitter)
+    InternetStackHelper internet;
+    return internet.AssignStreams(nodes, stream);
+}
+
 } // namespace ns3
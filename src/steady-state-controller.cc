@@ -0,0 +1,164 @@
+/**
+ * Steady-State Controller Implementation
+ *
+ * Group means are ratio estimates (Σ Δnum / Σ Δden), so batches with little
+ * traffic weigh less than in a plain mean of per-batch ratios. Groups with no
+ * denominator (e.g. no packets received) are skipped for that metric.
+ */
+
+#include "steady-state-controller.h"
+#include "result-aggregator.h"
+#include "ns3/log.h"
+#include <cmath>
+#include <limits>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("SteadyStateController");
+
+uint32_t MserTruncation(const std::vector<double>& series) {
+    const uint32_t n = series.size();
+    if (n < 2) return 0;
+
+    // Suffix sums give every mean/SSE in O(n)
+    std::vector<double> sum(n + 1, 0.0);
+    std::vector<double> sumSq(n + 1, 0.0);
+    for (uint32_t i = n; i-- > 0;) {
+        sum[i] = sum[i + 1] + series[i];
+        sumSq[i] = sumSq[i + 1] + series[i] * series[i];
+    }
+
+    uint32_t best = 0;
+    double bestStat = std::numeric_limits<double>::infinity();
+    for (uint32_t d = 0; d <= n / 2; ++d) {
+        double m = n - d;
+        double sse = sumSq[d] - sum[d] * sum[d] / m;
+        double stat = std::max(0.0, sse) / (m * m);
+        if (stat < bestStat) {
+            bestStat = stat;
+            best = d;
+        }
+    }
+    return best;
+}
+
+SteadyStateController::SteadyStateController(Time batchLength, double targetRelativeWidth,
+                                             double confidence, uint32_t minGroups)
+    : m_batchLength(batchLength),
+      m_target(targetRelativeWidth),
+      m_confidence(confidence),
+      m_minGroups(std::max(2u, minGroups)),
+      m_batches(0),
+      m_steady(false) {
+    NS_ASSERT_MSG(batchLength.IsStrictlyPositive(), "Batch length must be positive");
+}
+
+void SteadyStateController::AddRatioMetric(const std::string& name,
+                                           std::function<std::pair<double, double>()> cumulative) {
+    Metric metric;
+    metric.name = name;
+    metric.cumulative = std::move(cumulative);
+    metric.last = {0.0, 0.0};
+    metric.pendingNum = 0.0;
+    metric.pendingDen = 0.0;
+    m_metrics.push_back(std::move(metric));
+}
+
+void SteadyStateController::Start() {
+    NS_LOG_FUNCTION(this);
+    for (Metric& metric : m_metrics) {
+        metric.last = metric.cumulative();  // Exclude everything before traffic start
+    }
+    m_batchEvent = Simulator::Schedule(m_batchLength, &SteadyStateController::Batch, this);
+}
+
+void SteadyStateController::Batch() {
+    m_batches++;
+    for (Metric& metric : m_metrics) {
+        std::pair<double, double> now = metric.cumulative();
+        metric.pendingNum += now.first - metric.last.first;
+        metric.pendingDen += now.second - metric.last.second;
+        metric.last = now;
+        if (m_batches % GROUP_SIZE == 0) {
+            if (metric.pendingDen > 0.0) {
+                metric.groupNum.push_back(metric.pendingNum);
+                metric.groupDen.push_back(metric.pendingDen);
+            }
+            metric.pendingNum = 0.0;
+            metric.pendingDen = 0.0;
+        }
+    }
+
+    if (m_batches % GROUP_SIZE == 0 && !m_metrics.empty()) {
+        bool precise = true;
+        for (const Metric& metric : m_metrics) {
+            Estimate e = Evaluate(metric);
+            NS_LOG_DEBUG("t=" << Simulator::Now().GetSeconds() << "s " << e.name << ": " << e.mean
+                << " ± " << e.halfWidth << " (" << e.groups << " groups, " << e.truncated << " truncated)");
+            precise &= (e.groups >= m_minGroups && e.relativeWidth <= m_target);
+        }
+        if (precise) {
+            m_steady = true;
+            m_steadyTime = Simulator::Now();
+            NS_LOG_INFO("Steady state reached at t=" << m_steadyTime.GetSeconds() << "s after "
+                << m_batches << " batches");
+            if (m_stop) {
+                m_stop();
+            }
+            return;
+        }
+    }
+
+    m_batchEvent = Simulator::Schedule(m_batchLength, &SteadyStateController::Batch, this);
+}
+
+SteadyStateController::Estimate SteadyStateController::Evaluate(const Metric& metric) const {
+    Estimate e;
+    e.name = metric.name;
+    e.relativeWidth = std::numeric_limits<double>::infinity();
+
+    const uint32_t n = metric.groupNum.size();
+    if (n == 0) return e;
+
+    std::vector<double> means(n);
+    for (uint32_t i = 0; i < n; ++i) {
+        means[i] = metric.groupNum[i] / metric.groupDen[i];
+    }
+    e.truncated = MserTruncation(means);
+    e.groups = n - e.truncated;
+
+    double num = 0.0;
+    double den = 0.0;
+    double sum = 0.0;
+    for (uint32_t i = e.truncated; i < n; ++i) {
+        num += metric.groupNum[i];
+        den += metric.groupDen[i];
+        sum += means[i];
+    }
+    e.mean = num / den;
+    if (e.groups < 2) return e;
+
+    double groupMean = sum / e.groups;
+    double ss = 0.0;
+    for (uint32_t i = e.truncated; i < n; ++i) {
+        ss += (means[i] - groupMean) * (means[i] - groupMean);
+    }
+    double sem = std::sqrt(ss / (e.groups - 1) / e.groups);
+    e.halfWidth = StudentTQuantile(0.5 + m_confidence / 2.0, e.groups - 1) * sem;
+    if (e.mean != 0.0) {
+        e.relativeWidth = e.halfWidth / std::fabs(e.mean);
+    } else if (e.halfWidth == 0.0) {
+        e.relativeWidth = 0.0;  // Constant zero (e.g. no loss) is exact
+    }
+    return e;
+}
+
+std::vector<SteadyStateController::Estimate> SteadyStateController::GetEstimates() const {
+    std::vector<Estimate> estimates;
+    for (const Metric& metric : m_metrics) {
+        estimates.push_back(Evaluate(metric));
+    }
+    return estimates;
+}
+
+} // namespace ns3
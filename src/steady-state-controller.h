@@ -0,0 +1,120 @@
+/**
+ * Steady-State Controller
+ *
+ * Purpose: End a run once its metrics are estimated precisely enough
+ * Features:
+ * - Ratio metrics (PDR = rx/tx, delay = delaySum/rx, NRL = control/data bytes)
+ *   sampled from cumulative (numerator, denominator) counters every batch
+ * - MSER-5 initial-transient truncation: batches are grouped in fives and the
+ *   truncation point minimises the marginal standard error of the group means
+ * - Batch-means confidence interval over the retained groups (Student's t)
+ * - Stop rule: every metric's CI half-width / |mean| ≤ target, with at least
+ *   minGroups retained groups; the stop callback then ends the run
+ *
+ * Usage:
+ *   SteadyStateController steady(Seconds(1.0), 0.05);
+ *   steady.AddRatioMetric("pdr", [&]() { return std::make_pair(rx, tx); });
+ *   steady.SetStopCallback([&]() { ... stop senders, Simulator::Stop(drain) ... });
+ *   steady.Start();   // at traffic start
+ */
+
+#ifndef STEADY_STATE_CONTROLLER_H
+#define STEADY_STATE_CONTROLLER_H
+
+#include "ns3/core-module.h"
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * MSER truncation point of a series
+ *
+ * d* = argmin_{d ≤ n/2} Σ_{i≥d} (x_i − x̄_d)² / (n − d)², x̄_d = mean of x[d..n)
+ *
+ * @return Number of leading values to discard (0 for fewer than 2 values)
+ */
+uint32_t MserTruncation(const std::vector<double>& series);
+
+class SteadyStateController {
+public:
+    /**
+     * Point estimate and precision of one metric over the retained batches
+     */
+    struct Estimate {
+        std::string name;
+        double mean;           // Σ num / Σ den over retained batches
+        double halfWidth;      // CI half-width of the group means
+        double relativeWidth;  // halfWidth / |mean| (infinity if undefined)
+        uint32_t groups;       // Retained MSER-5 groups
+        uint32_t truncated;    // Groups discarded as warm-up
+
+        Estimate() : mean(0.0), halfWidth(0.0), relativeWidth(0.0), groups(0), truncated(0) {}
+    };
+
+    static const uint32_t GROUP_SIZE = 5;  // MSER-5
+
+    /**
+     * @param batchLength Batch duration
+     * @param targetRelativeWidth Stop when every metric's relative CI half-width ≤ this
+     * @param confidence CI confidence level
+     * @param minGroups Minimum retained groups before stopping
+     */
+    SteadyStateController(Time batchLength, double targetRelativeWidth,
+                          double confidence = 0.95, uint32_t minGroups = 10);
+
+    /**
+     * Track a ratio metric from a cumulative (numerator, denominator) source
+     */
+    void AddRatioMetric(const std::string& name, std::function<std::pair<double, double>()> cumulative);
+
+    /**
+     * Called once when the stop rule is met
+     */
+    void SetStopCallback(std::function<void()> callback) { m_stop = std::move(callback); }
+
+    /**
+     * Start batching now (first batch ends one batch length later)
+     */
+    void Start();
+
+    bool IsSteady() const { return m_steady; }
+    Time GetSteadyTime() const { return m_steadyTime; }
+    uint32_t GetBatches() const { return m_batches; }
+
+    /**
+     * Current estimates of all metrics (over complete groups)
+     */
+    std::vector<Estimate> GetEstimates() const;
+
+private:
+    struct Metric {
+        std::string name;
+        std::function<std::pair<double, double>()> cumulative;
+        std::pair<double, double> last;      // Cumulative values at the last boundary
+        std::vector<double> groupNum;        // Per complete group: Σ Δnum
+        std::vector<double> groupDen;        // Per complete group: Σ Δden
+        double pendingNum;                   // Current (incomplete) group
+        double pendingDen;
+    };
+
+    void Batch();
+    Estimate Evaluate(const Metric& metric) const;
+
+    std::vector<Metric> m_metrics;
+    Time m_batchLength;
+    double m_target;
+    double m_confidence;
+    uint32_t m_minGroups;
+    uint32_t m_batches;
+    bool m_steady;
+    Time m_steadyTime;
+    std::function<void()> m_stop;
+    EventId m_batchEvent;
+};
+
+} // namespace ns3
+
+#endif // STEADY_STATE_CONTROLLER_H
@@ -0,0 +1,127 @@
+/**
+ * Satellite Visibility Index Test
+ *
+ * Compares SatelliteVisibilityIndex::GetVisible against a brute-force elevation test
+ * over every satellite (same GetElevation, so any difference is a satellite the cell
+ * search skipped, i.e. a coverage cap that is not conservative):
+ * - 10^4 random terminals (plus poles and the antimeridian) × 10^3 satellites on a
+ *   random 500-1200 km shell, masks −5° … 60°, 5° and 15° cells
+ * - Terminals at 45° geodetic latitude (largest geodetic/geocentric difference, the
+ *   case CAP_MARGIN covers) and up to 5 km altitude
+ * - Walker-Delta 53:24/3/1 over one orbit with Earth rotation
+ */
+
+#include "satellite-visibility-index.h"
+#include "walker-delta-constellation.h"
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+namespace {
+
+const double MASKS[] = {-5.0, 0.0, 10.0, 25.0, 60.0};
+
+/**
+ * Uniform in [lo, hi) from the raw engine output (reproducible across standard libraries)
+ */
+double Uniform(std::mt19937& rng, double lo, double hi) {
+    return lo + (hi - lo) * (rng() / 4294967296.0);
+}
+
+/**
+ * Terminal/mask queries whose visible set differs from brute force
+ */
+uint64_t CountMismatches(const SatelliteVisibilityIndex& index, uint64_t& visibleTotal) {
+    uint64_t mismatches = 0;
+    std::vector<uint32_t> visible;
+    std::vector<uint32_t> expected;
+    for (double mask : MASKS) {
+        for (uint32_t t = 0; t < index.GetNumTerminals(); ++t) {
+            index.GetVisible(t, mask, visible);
+            expected.clear();
+            for (uint32_t s = 0; s < index.GetNumSatellites(); ++s) {
+                if (index.GetElevation(t, s) >= mask) expected.push_back(s);
+            }
+            visibleTotal += expected.size();
+            if (visible != expected) mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+bool Report(uint64_t mismatches, uint64_t visibleTotal, const std::string& name) {
+    std::cout << (mismatches == 0 ? "  ✓ " : "  ✗ ") << name << ": " << mismatches
+              << " mismatched queries (" << visibleTotal << " visible pairs)\n";
+    return mismatches == 0;
+}
+
+bool TestRandomShell(double cellSizeDeg) {
+    std::mt19937 rng(1);
+    std::vector<Vector> satellites;
+    while (satellites.size() < 1000) {
+        double x = Uniform(rng, -1.0, 1.0);
+        double y = Uniform(rng, -1.0, 1.0);
+        double z = Uniform(rng, -1.0, 1.0);
+        double norm = std::sqrt(x * x + y * y + z * z);
+        if (norm > 1.0 || norm < 0.1) continue;
+        double r = 6371e3 + Uniform(rng, 500e3, 1200e3);
+        satellites.push_back(Vector(x / norm * r, y / norm * r, z / norm * r));
+    }
+
+    SatelliteVisibilityIndex index(cellSizeDeg);
+    for (uint32_t i = 0; i < 10000; ++i) {
+        index.AddTerminal(Uniform(rng, -90.0, 90.0), Uniform(rng, -180.0, 180.0));
+    }
+    index.AddTerminal(90.0, 0.0);
+    index.AddTerminal(-90.0, 0.0);
+    index.AddTerminal(89.99, 10.0);
+    index.AddTerminal(0.0, 179.99);
+    index.AddTerminal(0.0, -180.0);
+    for (double lon = -180.0; lon < 180.0; lon += 7.5) {
+        index.AddTerminal(45.0, lon, 5000.0);
+        index.AddTerminal(-45.0, lon);
+    }
+    index.Update(satellites);
+
+    uint64_t visibleTotal = 0;
+    uint64_t mismatches = CountMismatches(index, visibleTotal);
+    return Report(mismatches, visibleTotal, "random shell, " + std::to_string(index.GetNumTerminals()) +
+                  " terminals × 1000 satellites, " + std::to_string(static_cast<int>(cellSizeDeg)) + "° cells");
+}
+
+bool TestWalker() {
+    WalkerDeltaConstellation constellation(3, 8, 1, 550000.0, 53.0);
+    SatelliteVisibilityIndex index;
+    for (double lat = -80.0; lat <= 80.0; lat += 10.0) {
+        for (double lon = -180.0; lon < 180.0; lon += 15.0) {
+            index.AddTerminal(lat, lon);
+        }
+    }
+
+    uint64_t visibleTotal = 0;
+    uint64_t mismatches = 0;
+    for (double t = 0.0; t < constellation.GetPeriod(); t += 60.0) {
+        index.Update(constellation, t);
+        mismatches += CountMismatches(index, visibleTotal);
+    }
+    return Report(mismatches, visibleTotal, "Walker-Delta 53:24/3/1, one orbit every 60 s");
+}
+
+} // namespace
+
+int main() {
+    std::cout << "=== Satellite Visibility Index Test ===\n";
+    bool ok = true;
+
+    ok = TestRandomShell(5.0) && ok;
+    ok = TestRandomShell(15.0) && ok;
+    ok = TestWalker() && ok;
+
+    std::cout << (ok ? "\nAll tests passed\n" : "\nTESTS FAILED\n");
+    return ok ? 0 : 1;
+}
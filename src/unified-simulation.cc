@@ -33,10 +33,38 @@
 #include "isl-network-creator.h"
 #include "static-isl-routing.h"
 #include "manhattan-mobility-helper.h"
+#include "manhattan-grid-mobility-model.h"
 #include "packet-tracer.h"
+#include "isl-failure-injector.h"
+#include "isl-table-routing.h"
+#include "isl-link-monitor.h"
+#include "walker-delta-constellation.h"
+#include "isl-snapshot-routing.h"
+#include "route-table-cache.h"
+#include "convergence-monitor.h"
+#include "steady-state-controller.h"
+#include "lean-udp-traffic.h"
+#include "rng-stream-plan.h"
+#include "visibility-windows.h"
+#include "multi-radio-ground-helper.h"
+#include "run-telemetry.h"
+#include "isl-queue-disc.h"
+#include "ground-qos-helper.h"
+#include "cached-propagation-loss-model.h"
+#include "unit-disk-net-device.h"
+#include "geometric-isl-routing.h"
+#include "isl-source-routing.h"
+#include "isl-traffic-engineering.h"
 #include <fstream>
 #include <iomanip>
+#include <cerrno>
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <sstream>
+#include <tuple>
 
 using namespace ns3;
 
@@ -47,6 +75,7 @@ int main(int argc, char *argv[]) {
     std::string islRouting = "static";
     std::string groundRouting = "aodv";
     uint32_t satellites = 24;
+    uint32_t islPlanes = 3;      // Walker-Delta orbital planes (satellites split evenly)
     uint32_t groundNodes = 20;
     double groundArea = 10000.0;  // 10 km radius
     double groundSpeed = 1.4;     // 1.4 m/s pedestrian
@@ -57,14 +86,57 @@ int main(int argc, char *argv[]) {
     double manhattanBlockSize = 100.0;  // Week 26: Manhattan block size (100m)
     double simTime = 60.0;
     uint32_t seed = 1;
+    bool crn = false;  // Common random numbers: fixed RNG stream per component/node/flow
     bool satelliteOnly = false;  // Week 28: Satellite-only mode (no ground layer)
     bool groundOnly = false;     // Week 28: Ground-only mode (no satellite layer)
     std::string outputFile = "results/unified_output.csv";
+    std::string islFailures = "";  // ISL failure schedule file (empty = none)
+    double islMtbf = 0.0;          // Random ISL failures: mean time between failures per link (0 = off)
+    double islMttr = 30.0;         // Random ISL failures: mean time to repair
+    std::string islForwarding = "static";  // Static ISL forwarding: static (host routes) | table | ecmp | snapshot | source
+    double islSnapshotInterval = 10.0;     // Snapshot forwarding: topology snapshot length (s)
+    double islMaxInterPlaneLat = 50.0;     // Snapshot forwarding: inter-plane links off above this |latitude|
+    std::string routeCacheDir = "";        // Snapshot forwarding: route table cache directory (empty = off)
+    bool islTe = false;                    // Load-aware ISL traffic engineering (table|source forwarding)
+    double islTeInterval = 1.0;            // TE: measurement / table swap interval (s)
+    double islTeHigh = 0.7;                // TE: link congested at this utilisation
+    double islTeLow = 0.4;                 // TE: congested link cleared at this utilisation
+    double islTePenalty = 2.0;             // TE: extra weight (hops) of a congested link
+    std::string convergenceMode = "fixed"; // Traffic start: fixed (t=20s) | adaptive (measured convergence)
+    double convergenceHold = 2.0;          // Adaptive: routes must be stable this long (s)
+    double convergenceCheck = 0.5;         // Adaptive: route probe interval (s)
+    double steadyTarget = 0.0;             // Steady-state stop: target relative CI half-width (0 = off)
+    double steadyBatch = 1.0;              // Steady-state stop: batch length (s)
+    double steadyDrain = 2.0;              // Steady-state stop: drain time after senders stop (s)
+    std::string trafficGen = "onoff";      // Test traffic: onoff (OnOffHelper/PacketSink) | lean (LeanUdpSource/Sink)
+    uint32_t trafficBurst = 1;             // Lean traffic: packets per send event
+    std::string trafficArrivals = "cbr";   // Lean traffic: cbr | poisson send times
+    std::string gatewaySite = "";          // Gateway handover schedule: "lat,lon" in degrees (empty = off)
+    double gatewayMask = 25.0;             // Gateway: minimum elevation (degrees)
+    std::string gatewayWindows = "";       // Gateway: visibility window file, reused when it matches
+    uint32_t groundRadios = 1;             // Ground: WiFi radios per mesh node
+    uint32_t groundChannels = 3;           // Ground: orthogonal channels for multi-radio nodes
+    std::string groundChannelAssignment = "static";  // Ground: channel assignment (static|greedy|hashed)
+    std::string telemetryDir = "";         // Live status block directory (empty = off)
+    std::string islQdisc = "default";      // ISL queue disc (default|prio)
+    bool groundQos = false;                // Ground: EDCA access categories per traffic class
+    std::string qosControlAc = "vo";       // Ground QoS: AC for routing control (vo|vi|be|bk)
+    std::string qosDataAc = "be";          // Ground QoS: AC for data (vo|vi|be|bk)
+    std::string groundPropagation = "range";  // Ground: propagation loss (range|logdistance|shadowing)
+    bool propagationCache = false;         // Ground: memoise per-pair loss
+    double propagationCacheDistance = 1.0; // Ground: cached loss reused until a node moves this far (m)
+    std::string groundPhy = "wifi";        // Ground link layer (wifi|unitdisk)
+    bool unitDiskCollisions = false;       // Unit-disk: collision model with carrier sense and backoff
+    double unitDiskAirtime = 200.0;        // Unit-disk: airtime per frame (µs)
+    double telemetryInterval = 1.0;        // Live status update interval (wall-clock s)
+    std::string islLinkStats = "";  // Per-link ISL stats output prefix (empty = off)
+    double islLinkInterval = 1.0;   // Per-link ISL stats sampling interval (s)
 
     CommandLine cmd;
-    cmd.AddValue("isl-routing", "ISL protocol (static|olsr|aodv)", islRouting);
-    cmd.AddValue("ground-routing", "Ground protocol (aodv|olsr|dsdv)", groundRouting);
+    cmd.AddValue("isl-routing", "ISL protocol (static|olsr|aodv|geometric)", islRouting);
+    cmd.AddValue("ground-routing", "Ground protocol (aodv|olsr|dsdv|hwmp)", groundRouting);
     cmd.AddValue("satellites", "Number of satellites", satellites);
+    cmd.AddValue("isl-planes", "Walker-Delta orbital planes (must divide --satellites)", islPlanes);
     cmd.AddValue("ground-nodes", "Number of ground mesh nodes", groundNodes);
     cmd.AddValue("ground-area", "Ground area radius (m)", groundArea);
     cmd.AddValue("ground-speed", "Ground node speed (m/s)", groundSpeed);
@@ -75,9 +147,51 @@ int main(int argc, char *argv[]) {
     cmd.AddValue("manhattan-block-size", "Manhattan block size (meters)", manhattanBlockSize);
     cmd.AddValue("time", "Simulation time (s)", simTime);
     cmd.AddValue("seed", "Random seed", seed);
+    cmd.AddValue("crn", "Fixed RNG streams per node/device/flow (common random numbers across protocols)", crn);
     cmd.AddValue("satellite-only", "Run satellite-only mode (no ground layer)", satelliteOnly);
     cmd.AddValue("ground-only", "Run ground-only mode (no satellite layer)", groundOnly);
     cmd.AddValue("output", "Output CSV file", outputFile);
+    cmd.AddValue("isl-failures", "ISL failure schedule CSV (time,link|sat,a,b,down|up)", islFailures);
+    cmd.AddValue("isl-mtbf", "Random ISL failures: per-link MTBF in seconds (0 = off)", islMtbf);
+    cmd.AddValue("isl-mttr", "Random ISL failures: per-link MTTR in seconds", islMttr);
+    cmd.AddValue("isl-forwarding", "Static ISL forwarding (static|table|ecmp|snapshot|source)", islForwarding);
+    cmd.AddValue("isl-snapshot-interval", "Snapshot forwarding: topology snapshot length (s)", islSnapshotInterval);
+    cmd.AddValue("isl-max-interplane-lat", "Snapshot forwarding: inter-plane ISLs inactive above this latitude (deg)", islMaxInterPlaneLat);
+    cmd.AddValue("route-cache-dir", "Snapshot forwarding: load/store route tables in this directory", routeCacheDir);
+    cmd.AddValue("isl-te", "Load-aware ISL traffic engineering (needs --isl-forwarding=table|source)", islTe);
+    cmd.AddValue("isl-te-interval", "TE: utilisation measurement and table swap interval (s)", islTeInterval);
+    cmd.AddValue("isl-te-high", "TE: utilisation at which a link becomes congested", islTeHigh);
+    cmd.AddValue("isl-te-low", "TE: utilisation at which a congested link is cleared", islTeLow);
+    cmd.AddValue("isl-te-penalty", "TE: extra weight of a congested link (hops)", islTePenalty);
+    cmd.AddValue("convergence", "Traffic start after fixed warm-up or measured route convergence (fixed|adaptive)", convergenceMode);
+    cmd.AddValue("convergence-hold", "Adaptive convergence: hold-down with stable routes (s)", convergenceHold);
+    cmd.AddValue("convergence-check", "Adaptive convergence: route probe interval (s)", convergenceCheck);
+    cmd.AddValue("steady-state", "Stop once PDR/delay/NRL relative CI half-widths are below this (0 = run full --time)", steadyTarget);
+    cmd.AddValue("steady-batch", "Steady-state stop: batch length (s)", steadyBatch);
+    cmd.AddValue("steady-drain", "Steady-state stop: drain time after senders stop (s)", steadyDrain);
+    cmd.AddValue("traffic", "Test traffic generator (onoff|lean)", trafficGen);
+    cmd.AddValue("traffic-burst", "Lean traffic: packets sent per scheduled event (same mean rate)", trafficBurst);
+    cmd.AddValue("traffic-arrivals", "Lean traffic: send times (cbr|poisson)", trafficArrivals);
+    cmd.AddValue("gateway-site", "Gateway site for the satellite handover schedule (lat,lon in degrees; schedule and coverage statistics only, no gateway node is attached)", gatewaySite);
+    cmd.AddValue("gateway-mask", "Gateway minimum elevation (degrees)", gatewayMask);
+    cmd.AddValue("gateway-windows", "Gateway visibility window file (loaded if it matches, else computed and written)", gatewayWindows);
+    cmd.AddValue("ground-radios", "WiFi radios per ground mesh node (radio 0 on the common channel)", groundRadios);
+    cmd.AddValue("ground-channels", "Orthogonal WiFi channels for multi-radio ground nodes", groundChannels);
+    cmd.AddValue("ground-channel-assignment", "Multi-radio channel assignment (static|greedy|hashed)", groundChannelAssignment);
+    cmd.AddValue("isl-qdisc", "ISL queue discipline (default = FQ-CoDel | prio = routing control strictly first, FQ-CoDel for data)", islQdisc);
+    cmd.AddValue("ground-qos", "QoS ad-hoc MAC: routing control and data in separate EDCA access categories", groundQos);
+    cmd.AddValue("qos-control-ac", "Ground QoS: access category for routing control (vo|vi|be|bk)", qosControlAc);
+    cmd.AddValue("qos-data-ac", "Ground QoS: access category for data (vo|vi|be|bk)", qosDataAc);
+    cmd.AddValue("ground-propagation", "Ground propagation loss (range = 200 m disc | logdistance = exponent 3, calibrated to 200 m | shadowing = log-distance + 4 dB log-normal)", groundPropagation);
+    cmd.AddValue("propagation-cache", "Cache ground propagation loss per node pair until a node changes course or moves (with shadowing: fixed reciprocal draw per pair instead of per frame, a different model)", propagationCache);
+    cmd.AddValue("propagation-cache-distance", "Propagation cache: recompute after a node moved this far (m)", propagationCacheDistance);
+    cmd.AddValue("ground-phy", "Ground link layer (wifi = 802.11n Yans | unitdisk = fast unit-disk model for overhead studies)", groundPhy);
+    cmd.AddValue("unitdisk-collisions", "Unit-disk: overlapping frames collide (carrier sense, backoff, retries)", unitDiskCollisions);
+    cmd.AddValue("unitdisk-airtime", "Unit-disk: airtime per frame (microseconds)", unitDiskAirtime);
+    cmd.AddValue("telemetry", "Publish live run status for run-monitor in this directory (e.g. /dev/shm/dymen)", telemetryDir);
+    cmd.AddValue("telemetry-interval", "Live run status update interval (wall-clock seconds)", telemetryInterval);
+    cmd.AddValue("isl-link-stats", "Per-link ISL stats prefix (writes <prefix>_timeseries.csv, <prefix>_summary.csv)", islLinkStats);
+    cmd.AddValue("isl-link-interval", "Per-link ISL stats sampling interval (s)", islLinkInterval);
     cmd.Parse(argc, argv);
 
     // Validate mode exclusivity
@@ -85,23 +199,169 @@ int main(int argc, char *argv[]) {
         std::cerr << "ERROR: Cannot use both --satellite-only and --ground-only flags\n";
         return 1;
     }
+    if (islForwarding != "static" && islForwarding != "table" && islForwarding != "ecmp" &&
+        islForwarding != "snapshot" && islForwarding != "source") {
+        std::cerr << "ERROR: Unknown --isl-forwarding '" << islForwarding << "' (static|table|ecmp|snapshot|source)\n";
+        return 1;
+    }
+    if (islMtbf < 0.0 || (islMtbf > 0.0 && islMttr <= 0.0)) {
+        std::cerr << "ERROR: --isl-mtbf must be non-negative and --isl-mttr positive\n";
+        return 1;
+    }
+    if (islForwarding == "snapshot") {
+        if (islSnapshotInterval <= 0.0) {
+            std::cerr << "ERROR: --isl-snapshot-interval must be positive\n";
+            return 1;
+        }
+        if (!islFailures.empty() || islMtbf > 0.0) {
+            std::cerr << "ERROR: --isl-forwarding=snapshot cannot be combined with ISL failure injection\n";
+            return 1;
+        }
+    }
+    if (!groundOnly && (islPlanes < 3 || satellites % islPlanes != 0 || satellites / islPlanes < 3)) {
+        std::cerr << "ERROR: --satellites must split into --isl-planes (at least 3) planes of at least 3 satellites\n";
+        return 1;
+    }
+    if (!groundOnly && satellites < 24) {
+        std::cerr << "ERROR: --satellites must be at least 24 (test flows use satellites 0-23)\n";
+        return 1;
+    }
+    if (islRouting == "geometric" && islForwarding != "static") {
+        std::cerr << "ERROR: --isl-routing=geometric forwards on its own; use --isl-forwarding=static\n";
+        return 1;
+    }
+    if (islForwarding != "static" && islRouting != "static") {
+        std::cerr << "ERROR: --isl-forwarding=" << islForwarding << " needs --isl-routing=static\n";
+        return 1;
+    }
+    if (islTe) {
+        if (islRouting != "static" || (islForwarding != "table" && islForwarding != "source")) {
+            std::cerr << "ERROR: --isl-te needs --isl-routing=static and --isl-forwarding=table|source\n";
+            return 1;
+        }
+        if (!islFailures.empty() || islMtbf > 0.0) {
+            std::cerr << "ERROR: --isl-te cannot be combined with ISL failure injection\n";
+            return 1;
+        }
+        if (islTeInterval <= 0.0 || islTeLow < 0.0 || islTeLow >= islTeHigh || islTePenalty < 0.0) {
+            std::cerr << "ERROR: --isl-te needs a positive interval, 0 <= low < high and a non-negative penalty\n";
+            return 1;
+        }
+    }
+    if (!islLinkStats.empty() && islLinkInterval <= 0.0) {
+        std::cerr << "ERROR: --isl-link-interval must be positive\n";
+        return 1;
+    }
+    if (convergenceMode != "fixed" && convergenceMode != "adaptive") {
+        std::cerr << "ERROR: Unknown --convergence '" << convergenceMode << "' (fixed|adaptive)\n";
+        return 1;
+    }
+    if (convergenceCheck <= 0.0 || convergenceHold < 0.0) {
+        std::cerr << "ERROR: --convergence-check must be positive and --convergence-hold non-negative\n";
+        return 1;
+    }
+    const bool adaptiveConvergence = (convergenceMode == "adaptive");
+    if (steadyTarget < 0.0 || steadyBatch <= 0.0 || steadyDrain < 0.0) {
+        std::cerr << "ERROR: --steady-batch must be positive, --steady-state (0 = off) and --steady-drain non-negative\n";
+        return 1;
+    }
+    const bool steadyStateEnabled = steadyTarget > 0.0;
+    if (trafficGen != "onoff" && trafficGen != "lean") {
+        std::cerr << "ERROR: Unknown --traffic '" << trafficGen << "' (onoff|lean)\n";
+        return 1;
+    }
+    if (trafficArrivals != "cbr" && trafficArrivals != "poisson") {
+        std::cerr << "ERROR: Unknown --traffic-arrivals '" << trafficArrivals << "' (cbr|poisson)\n";
+        return 1;
+    }
+    if (trafficBurst == 0) {
+        std::cerr << "ERROR: --traffic-burst must be at least 1\n";
+        return 1;
+    }
+    const bool leanTraffic = (trafficGen == "lean");
+    double gatewayLat = 0.0;
+    double gatewayLon = 0.0;
+    if (!gatewaySite.empty() &&
+        (std::sscanf(gatewaySite.c_str(), "%lf,%lf", &gatewayLat, &gatewayLon) != 2 ||
+         std::fabs(gatewayLat) > 90.0 || std::fabs(gatewayLon) > 180.0)) {
+        std::cerr << "ERROR: --gateway-site must be 'lat,lon' in degrees\n";
+        return 1;
+    }
+    MultiRadioGroundHelper::Strategy channelStrategy = MultiRadioGroundHelper::STATIC;
+    if (!MultiRadioGroundHelper::ParseStrategy(groundChannelAssignment, channelStrategy)) {
+        std::cerr << "ERROR: Unknown --ground-channel-assignment '" << groundChannelAssignment
+                  << "' (static|greedy|hashed)\n";
+        return 1;
+    }
+    if (groundRadios == 0 || groundChannels < groundRadios) {
+        std::cerr << "ERROR: --ground-radios must be at least 1 and --ground-channels at least --ground-radios\n";
+        return 1;
+    }
+    if (islQdisc != "default" && islQdisc != "prio") {
+        std::cerr << "ERROR: Unknown --isl-qdisc '" << islQdisc << "' (default|prio)\n";
+        return 1;
+    }
+    AcIndex controlAc = AC_VO;
+    AcIndex dataAc = AC_BE;
+    if (!GroundQosHelper::ParseAc(qosControlAc, controlAc) || !GroundQosHelper::ParseAc(qosDataAc, dataAc)) {
+        std::cerr << "ERROR: --qos-control-ac and --qos-data-ac must be vo|vi|be|bk\n";
+        return 1;
+    }
+    if (groundPropagation != "range" && groundPropagation != "logdistance" && groundPropagation != "shadowing") {
+        std::cerr << "ERROR: Unknown --ground-propagation '" << groundPropagation << "' (range|logdistance|shadowing)\n";
+        return 1;
+    }
+    if (propagationCacheDistance < 0.0) {
+        std::cerr << "ERROR: --propagation-cache-distance must be non-negative\n";
+        return 1;
+    }
+    const bool unitDisk = groundPhy == "unitdisk";
+    if (groundPhy != "wifi" && !unitDisk) {
+        std::cerr << "ERROR: Unknown --ground-phy '" << groundPhy << "' (wifi|unitdisk)\n";
+        return 1;
+    }
+    if (unitDisk && (groundRouting == "hwmp" || groundRadios > 1 || groundQos ||
+                     groundPropagation != "range" || propagationCache)) {
+        std::cerr << "ERROR: --ground-phy=unitdisk excludes hwmp, --ground-radios, --ground-qos and "
+                     "--ground-propagation/--propagation-cache (WiFi only)\n";
+        return 1;
+    }
+    if (unitDiskAirtime <= 0.0) {
+        std::cerr << "ERROR: --unitdisk-airtime must be positive\n";
+        return 1;
+    }
+    if (groundQos && groundRouting == "hwmp") {
+        std::cerr << "ERROR: --ground-qos applies to the ad-hoc WiFi MAC (not --ground-routing=hwmp)\n";
+        return 1;
+    }
+    if (!telemetryDir.empty() && telemetryInterval <= 0.0) {
+        std::cerr << "ERROR: --telemetry-interval must be positive\n";
+        return 1;
+    }
+    if (groundRouting == "hwmp" && groundRadios > 1) {
+        std::cerr << "ERROR: --ground-routing=hwmp creates its own mesh devices (single radio only)\n";
+        return 1;
+    }
 
     // Validate simulation time (applications start at t=20s, stop at t=simTime-10s)
-    // Required: start time (20s) + minimum traffic duration (30s) + buffer (5s) = 55s
+    // Required: start time (20s) + minimum traffic duration (30s) + buffer (10s) = 60s
+    // Adaptive convergence only reserves the hold-down; traffic starts as soon as routes
+    // are stable and at the latest when MIN_TRAFFIC_DURATION would no longer fit.
     const double CONVERGENCE_TIME = 20.0;  // Time for routing protocol convergence
     const double MIN_TRAFFIC_DURATION = 30.0;  // Minimum traffic duration
     const double END_BUFFER = 10.0;  // Buffer before simulation end
-    const double MIN_SIM_TIME = CONVERGENCE_TIME + MIN_TRAFFIC_DURATION + END_BUFFER;
+    const double WARMUP = adaptiveConvergence ? convergenceHold : CONVERGENCE_TIME;
+    const double MIN_SIM_TIME = WARMUP + MIN_TRAFFIC_DURATION + END_BUFFER;
 
     if (simTime < MIN_SIM_TIME) {
         std::cerr << "ERROR: simTime (" << simTime << "s) is too short for traffic generation!\n";
         std::cerr << "       Minimum required: " << MIN_SIM_TIME << "s\n";
-        std::cerr << "       Breakdown: " << CONVERGENCE_TIME << "s convergence + "
+        std::cerr << "       Breakdown: " << WARMUP << "s convergence + "
                   << MIN_TRAFFIC_DURATION << "s traffic + " << END_BUFFER << "s buffer\n";
         std::cerr << "\n";
-        std::cerr << "       Applications start at t=" << CONVERGENCE_TIME << "s\n";
+        std::cerr << "       Applications start at t=" << WARMUP << "s" << (adaptiveConvergence ? " (earliest)" : "") << "\n";
         std::cerr << "       Applications stop at t=" << (simTime - END_BUFFER) << "s\n";
-        std::cerr << "       Traffic duration would be: " << (simTime - END_BUFFER - CONVERGENCE_TIME) << "s (need >= " << MIN_TRAFFIC_DURATION << "s)\n";
+        std::cerr << "       Traffic duration would be: " << (simTime - END_BUFFER - WARMUP) << "s (need >= " << MIN_TRAFFIC_DURATION << "s)\n";
         return 1;
     }
 
@@ -136,7 +396,7 @@ int main(int argc, char *argv[]) {
     }
     std::cout << "Ground speed: " << groundSpeed << " m/s\n";
     std::cout << "Sim time: " << simTime << " seconds\n";
-    std::cout << "RNG seed: " << seed << "\n";
+    std::cout << "RNG seed: " << seed << (crn ? " (fixed streams per node/device/flow)" : "") << "\n";
     std::cout << "Output: " << outputFile << "\n\n";
 
     // Step 1: Create satellites with constant positions (skip if ground-only mode)
@@ -148,45 +408,31 @@ int main(int argc, char *argv[]) {
 
     // Satellite positioning and ISL topology (skip if ground-only mode)
     IslTopology topology;
+    // Walker-Delta 53:T/P/0 geometry: 550 km altitude, 53° inclination, --isl-planes
+    // planes (default 53:24/3/1: 3 planes × 8), phasing 0: same true anomaly in every
+    // plane. Positions are fixed at their t=0 values unless ISL snapshot routing moves
+    // them at snapshot boundaries.
+    const uint32_t NUM_PLANES = islPlanes;
+    const uint32_t SATS_PER_PLANE = groundOnly ? 1 : satellites / islPlanes;  // Unused in ground-only mode
+    WalkerDeltaConstellation constellation(NUM_PLANES, SATS_PER_PLANE, 0, 550000.0, 53.0);
     if (!groundOnly) {
-        // Use ConstantPositionMobilityModel (Walker-Delta 53:24/3/1)
-        const double ORBIT_RADIUS = 6371000.0 + 550000.0; // Earth radius + 550 km altitude (meters)
-        const double INCLINATION = 53.0 * M_PI / 180.0;
-        const uint32_t NUM_PLANES = 3;
-        const uint32_t SATS_PER_PLANE = 8;
-
+        // Use ConstantPositionMobilityModel (Walker-Delta)
         MobilityHelper mobility;
         mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
         Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator>();
 
         for (uint32_t i = 0; i < satellites; ++i) {
-        uint32_t plane = i / SATS_PER_PLANE;
-        uint32_t idx = i % SATS_PER_PLANE;
-
-        // Right Ascension of Ascending Node (RAAN)
-        double raan = plane * (360.0 / NUM_PLANES) * M_PI / 180.0;
-
-        // True Anomaly
-        double trueAnomaly = idx * (360.0 / SATS_PER_PLANE) * M_PI / 180.0;
-
-        // Convert to TEME coordinates
-        double x = ORBIT_RADIUS * (std::cos(raan) * std::cos(trueAnomaly) -
-            std::sin(raan) * std::sin(trueAnomaly) * std::cos(INCLINATION));
-        double y = ORBIT_RADIUS * (std::sin(raan) * std::cos(trueAnomaly) +
-            std::cos(raan) * std::sin(trueAnomaly) * std::cos(INCLINATION));
-        double z = ORBIT_RADIUS * std::sin(trueAnomaly) * std::sin(INCLINATION);
-
-        positionAlloc->Add(Vector(x, y, z));
-    }
+            positionAlloc->Add(constellation.GetPosition(i, 0.0)); // TEME coordinates
+        }
 
         mobility.SetPositionAllocator(positionAlloc);
         mobility.Install(satNodes);
 
-        std::cout << "  ✓ Satellites positioned in Walker-Delta 53:24/3/1\n";
+        std::cout << "  ✓ Satellites positioned in Walker-Delta 53:" << satellites << "/" << NUM_PLANES << "\n";
 
         // Step 2: Generate ISL topology (before installing routing)
         std::cout << "[2/9] Generating ISL topology (4 neighbors per satellite)...\n";
-        topology = GenerateWalkerDeltaTopology(satellites, 4);
+        topology = GenerateWalkerDeltaTopology(satellites, 4, NUM_PLANES);
         std::cout << "  ✓ ISL topology: " << topology.numSatellites << " satellites, "
             << topology.numLinks << " bidirectional links\n";
     }
@@ -241,12 +487,24 @@ int main(int argc, char *argv[]) {
                                           "Pause", StringValue(pauseStr.str()),
                                           "PositionAllocator", PointerValue(waypointAllocator));
             meshMobility.Install(meshNodes);
+            if (crn) {
+                // Speed/pause/waypoint draws per node; the shared waypoint allocator ends up on
+                // the last node's slot (draw order follows mobility events, not the protocol)
+                for (uint32_t i = 0; i < groundNodes; ++i) {
+                    RngStreamPlan::Assign(RngStreamPlan::GROUND_MOBILITY, i, [&](int64_t stream) {
+                        return meshMobility.AssignStreams(NodeContainer(meshNodes.Get(i)), stream);
+                    });
+                }
+            }
             std::cout << "  ✓ Ground nodes: RandomWaypoint mobility"
                       << " (speed=" << groundSpeed << " m/s, pause=" << groundPause << "s)\n";
         } else if (groundMobility == "manhattan") {
             // Week 26: Manhattan Grid mobility
             // Create Manhattan Grid helper
             ManhattanGridHelper grid(manhattanBlocks, manhattanBlockSize, groundBounds);
+            if (crn) {
+                grid.AssignStreams(RngStreamPlan::GetStream(RngStreamPlan::GROUND_PLACEMENT, 0));
+            }
             std::vector<Vector> intersections = grid.GetIntersections();
 
             std::cout << "  Manhattan Grid: " << manhattanBlocks << "×" << manhattanBlocks
@@ -259,43 +517,27 @@ int main(int argc, char *argv[]) {
                 positionAlloc->Add(pos);
             }
 
-            // Use WaypointMobilityModel with grid-constrained waypoints
+            // Street-constrained movement, one block at a time, generated as nodes go
+            // (starts after convergence; no waypoint limit, constant memory per node)
             meshMobility.SetPositionAllocator(positionAlloc);
-            meshMobility.SetMobilityModel("ns3::WaypointMobilityModel");
+            meshMobility.SetMobilityModel("ns3::ManhattanGridMobilityModel",
+                                          "Blocks", UintegerValue(grid.GetBlocks()),
+                                          "BlockSize", DoubleValue(grid.GetBlockSize()),
+                                          "Speed", DoubleValue(groundSpeed),
+                                          "Pause", TimeValue(Seconds(groundPause)),
+                                          "StartTime", TimeValue(Seconds(CONVERGENCE_TIME)));
             meshMobility.Install(meshNodes);
-
-            // Schedule waypoints for each node (pre-compute path)
-            double currentTime = 0.0;
-            uint32_t waypointsPerNode = static_cast<uint32_t>((simTime - 20.0) /
-                (grid.GetBlockSize() / groundSpeed + groundPause)) + 1;
-            waypointsPerNode = std::min(waypointsPerNode, 20u);  // Cap at 20 waypoints
-
-            for (uint32_t i = 0; i < groundNodes; i++) {
-                Ptr<WaypointMobilityModel> waypoint =
-                    meshNodes.Get(i)->GetObject<WaypointMobilityModel>();
-
-                // Schedule random waypoints on grid intersections
-                double nodeTime = 20.0;  // Start movement after convergence
-                for (uint32_t w = 0; w < waypointsPerNode; w++) {
-                    Vector target = grid.GetRandomIntersection();
-                    Vector current = waypoint->GetPosition();
-
-                    // Calculate travel time based on distance and speed
-                    double distance = std::sqrt(std::pow(target.x - current.x, 2) +
-                                                std::pow(target.y - current.y, 2));
-                    double travelTime = distance / groundSpeed;
-
-                    nodeTime += travelTime;
-                    waypoint->AddWaypoint(Waypoint(Time(Seconds(nodeTime)), target));
-
-                    // Add pause time
-                    nodeTime += groundPause;
+            if (crn) {
+                for (uint32_t i = 0; i < groundNodes; ++i) {
+                    RngStreamPlan::Assign(RngStreamPlan::GROUND_MOBILITY, i, [&](int64_t stream) {
+                        return meshMobility.AssignStreams(NodeContainer(meshNodes.Get(i)), stream);
+                    });
                 }
             }
 
             std::cout << "  ✓ Ground nodes: Manhattan Grid mobility"
                       << " (speed=" << groundSpeed << " m/s, pause=" << groundPause
-                      << "s, " << waypointsPerNode << " waypoints/node)\n";
+                      << "s per intersection, street segments generated on the fly)\n";
         } else {
             std::cout << "  ERROR: Unknown mobility model '" << groundMobility << "'\n";
             std::cout << "  Valid options: static, waypoint, manhattan\n";
@@ -308,23 +550,35 @@ int main(int argc, char *argv[]) {
     if (!groundOnly) {
         std::cout << "[3/" << (groundNodes > 0 ? "12" : "9") << "] Creating ISL routing protocol...\n";
         islProtocol = RoutingProtocolFactory::Create(islRouting);
+        if (islRouting == "geometric") {
+            islProtocol->SetParameter("planes", std::to_string(NUM_PLANES));
+            islProtocol->SetParameter("sats_per_plane", std::to_string(SATS_PER_PLANE));
+        }
         std::cout << "  ✓ ISL Protocol: " << islProtocol->GetName()
                   << " (category: " << islProtocol->GetCategory() << ")\n";
     }
 
     // Step 3a: Create ground protocol via factory (if ground layer enabled and not satellite-only)
     std::unique_ptr<RoutingProtocol> groundProtocol;
+    HwmpRoutingProtocol* hwmpProtocol = nullptr;  // Layer-2 mesh: creates the ground devices itself
     if (groundNodes > 0 && !satelliteOnly) {
         std::cout << "[3a/12] Creating ground routing protocol...\n";
         groundProtocol = RoutingProtocolFactory::Create(groundRouting);
+        hwmpProtocol = dynamic_cast<HwmpRoutingProtocol*>(groundProtocol.get());
         std::cout << "  ✓ Ground Protocol: " << groundProtocol->GetName()
                   << " (category: " << groundProtocol->GetCategory() << ")\n";
     }
 
     // Step 3b: Create ground WiFi ad-hoc network BEFORE installing protocols
     // (Devices must exist before InternetStackHelper is installed)
+    const double GROUND_RANGE = 200.0;  // 200m range (realistic 802.11n outdoor mesh)
     NetDeviceContainer groundDevices;
     Ipv4InterfaceContainer groundInterfaces;
+    MultiRadioGroundHelper groundRadioHelper(groundRadios, groundChannels, channelStrategy, GROUND_RANGE);
+    GroundQosHelper groundQosHelper(controlAc, dataAc);
+    const bool groundQosEnabled = groundQos && groundNodes > 0 && !satelliteOnly;
+    Ptr<CachedPropagationLossModel> groundLoss;  // Set unless the default uncached range model is used
+    UnitDiskHelper unitDiskHelper;
     if (groundNodes > 0 && !satelliteOnly) {
         std::cout << "[3b/12] Creating ground WiFi ad-hoc network...\n";
 
@@ -332,10 +586,50 @@ int main(int argc, char *argv[]) {
         YansWifiChannelHelper channel;
         channel.SetPropagationDelay("ns3::ConstantSpeedPropagationDelayModel");
         channel.AddPropagationLoss("ns3::RangePropagationLossModel",
-                                   "MaxRange", DoubleValue(200.0)); // 200m range (realistic 802.11n outdoor mesh)
+                                   "MaxRange", DoubleValue(GROUND_RANGE));
 
         YansWifiPhyHelper phy;
-        phy.SetChannel(channel.Create());
+        Ptr<YansWifiChannel> groundChannel = channel.Create();
+        phy.SetChannel(groundChannel);
+
+        // Realistic and/or cached propagation: one loss model shared by all ground channels
+        if (groundPropagation != "range" || propagationCache) {
+            Ptr<PropagationLossModel> model;
+            if (groundPropagation == "range") {
+                model = CreateObjectWithAttributes<RangePropagationLossModel>("MaxRange", DoubleValue(GROUND_RANGE));
+            } else {
+                // Calibrated to GROUND_RANGE. Preamble detection, not RxSensitivity, sets the
+                // range: with the 5 GHz free-space ReferenceLoss (46.7 dB) the default −82 dBm
+                // MinimumRssi ends reception at ≈ 51 m, and HtMcs7 (≈ 24 dB SNR over the −94 dBm
+                // noise floor) decodes only to ≈ 20 m. Here −67 dBm arrives at GROUND_RANGE and
+                // detection stops at −68 dBm (≈ 216 m, short of the 224 m grid diagonal), so
+                // broadcast control and HtMcs7 data reach the same neighbours.
+                const double TX_POWER_DBM = 16.0206;  // YansWifiPhy default
+                const double EXPONENT = 3.0;
+                const double RX_AT_RANGE_DBM = -67.0;
+                const double MIN_RSSI_DBM = -68.0;
+                const double referenceLoss = TX_POWER_DBM - RX_AT_RANGE_DBM - 10.0 * EXPONENT * std::log10(GROUND_RANGE);
+                phy.Set("TxPowerStart", DoubleValue(TX_POWER_DBM));
+                phy.Set("TxPowerEnd", DoubleValue(TX_POWER_DBM));
+                phy.SetPreambleDetectionModel("ns3::ThresholdPreambleDetectionModel",
+                                              "MinimumRssi", DoubleValue(MIN_RSSI_DBM));
+                model = CreateObjectWithAttributes<LogDistancePropagationLossModel>(
+                    "Exponent", DoubleValue(EXPONENT),
+                    "ReferenceDistance", DoubleValue(1.0),
+                    "ReferenceLoss", DoubleValue(referenceLoss));
+                if (groundPropagation == "shadowing") {
+                    // Cached: one draw per node pair and position epoch, reciprocal.
+                    // Uncached: a fresh draw per frame and direction. These are two
+                    // different channel models, so the cache is not a pure speed-up here
+                    model->SetNext(CreateObjectWithAttributes<RandomPropagationLossModel>(
+                        "Variable", StringValue("ns3::NormalRandomVariable[Mean=0.0|Variance=16.0|Bound=12.0]")));
+                }
+            }
+            groundLoss = CreateObjectWithAttributes<CachedPropagationLossModel>(
+                "Model", PointerValue(model),
+                "DistanceThreshold", DoubleValue(propagationCacheDistance),
+                "Enabled", BooleanValue(propagationCache));
+        }
 
         // WiFi MAC layer (ad-hoc mode)
         WifiMacHelper mac;
@@ -347,9 +641,56 @@ int main(int argc, char *argv[]) {
         wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
                                      "DataMode", StringValue("HtMcs7"),
                                      "ControlMode", StringValue("HtMcs0"));
+        if (groundQosEnabled) {
+            groundQosHelper.Configure(wifi, mac);
+        }
 
-        groundDevices = wifi.Install(phy, mac, meshNodes);
-        std::cout << "  ✓ Ground WiFi devices: " << groundDevices.GetN() << "\n";
+        // Radio 0 of every node on this channel; further radios on their own channels
+        // (HWMP: one 802.11s mesh point device per node on this channel instead;
+        // unit-disk: no WiFi at all, same range)
+        if (hwmpProtocol) {
+            groundDevices = hwmpProtocol->InstallDevices(phy, meshNodes);
+        } else if (unitDisk) {
+            unitDiskHelper.SetChannelAttribute("Range", DoubleValue(GROUND_RANGE));
+            unitDiskHelper.SetChannelAttribute("Airtime", TimeValue(MicroSeconds(unitDiskAirtime)));
+            unitDiskHelper.SetChannelAttribute("Collisions", BooleanValue(unitDiskCollisions));
+            groundDevices = unitDiskHelper.Install(meshNodes);
+        } else {
+            groundDevices = groundRadioHelper.Install(wifi, phy, mac, channel, meshNodes);
+        }
+        if (groundLoss) {
+            std::set<Ptr<YansWifiChannel>> groundWifiChannels = {groundChannel};
+            for (uint32_t i = 0; i < groundDevices.GetN(); ++i) {
+                Ptr<WifiNetDevice> device = DynamicCast<WifiNetDevice>(groundDevices.Get(i));
+                if (device) {
+                    groundWifiChannels.insert(DynamicCast<YansWifiChannel>(device->GetChannel()));
+                }
+            }
+            for (const Ptr<YansWifiChannel>& wifiChannel : groundWifiChannels) {
+                wifiChannel->SetPropagationLossModel(groundLoss);
+            }
+        }
+        if (crn) {
+            for (uint32_t i = 0; i < groundDevices.GetN(); ++i) {
+                RngStreamPlan::Assign(RngStreamPlan::GROUND_DEVICES, i, [&](int64_t stream) {
+                    NetDeviceContainer device(groundDevices.Get(i));
+                    return unitDisk ? unitDiskHelper.AssignStreams(device, stream) : wifi.AssignStreams(device, stream);
+                });
+            }
+            if (groundLoss) {
+                groundLoss->AssignStreams(RngStreamPlan::GetStream(RngStreamPlan::GROUND_CHANNEL, 0));
+            }
+        }
+        std::cout << "  ✓ Ground " << (unitDisk ? "unit-disk" : "WiFi") << " devices: " << groundDevices.GetN() << "\n";
+        if (groundQosEnabled) {
+            groundQosHelper.Install(groundDevices);
+            std::cout << "  ✓ EDCA: routing control → AC_" << qosControlAc << ", data → AC_" << qosDataAc << "\n";
+        }
+        if (groundRadios > 1) {
+            std::cout << "  ✓ Radios per node: " << groundRadios << " on " << groundChannels
+                      << " channels (" << groundChannelAssignment << "), "
+                      << groundRadioHelper.GetDataLinks() << " links on data channels\n";
+        }
     }
 
     // Step 4: Install ISL protocol (creates internet stack for satellites, skip if ground-only)
@@ -357,6 +698,13 @@ int main(int argc, char *argv[]) {
         std::cout << "[4/" << (groundNodes > 0 ? "12" : "9") << "] Installing ISL routing protocol...\n";
         NodeContainer emptyNodes;  // ISL protocol doesn't use ground nodes
         islProtocol->Install(satNodes, emptyNodes);
+        if (crn) {
+            for (uint32_t i = 0; i < satNodes.GetN(); ++i) {
+                RngStreamPlan::Assign(RngStreamPlan::ISL_ROUTING, i, [&](int64_t stream) {
+                    return islProtocol->AssignStreams(NodeContainer(satNodes.Get(i)), stream);
+                });
+            }
+        }
         std::cout << "  ✓ ISL routing protocol installed on " << satellites << " satellites\n";
     }
 
@@ -366,6 +714,13 @@ int main(int argc, char *argv[]) {
         std::cout << "[4a/12] Installing ground routing protocol...\n";
         NodeContainer emptyIslNodes;  // Ground protocol doesn't use ISL nodes
         groundProtocol->Install(emptyIslNodes, meshNodes);
+        if (crn) {
+            for (uint32_t i = 0; i < meshNodes.GetN(); ++i) {
+                RngStreamPlan::Assign(RngStreamPlan::GROUND_ROUTING, i, [&](int64_t stream) {
+                    return groundProtocol->AssignStreams(NodeContainer(meshNodes.Get(i)), stream);
+                });
+            }
+        }
         std::cout << "  ✓ Ground routing protocol installed on " << groundNodes << " mesh nodes\n";
     }
 
@@ -373,30 +728,132 @@ int main(int argc, char *argv[]) {
     // (Must happen AFTER InternetStackHelper is installed)
     if (groundNodes > 0 && !satelliteOnly) {
         std::cout << "[4b/12] Assigning IP addresses to ground mesh...\n";
-        Ipv4AddressHelper groundAddress;
-        groundAddress.SetBase("10.1.0.0", "255.255.0.0");
-        groundInterfaces = groundAddress.Assign(groundDevices);
+        if (hwmpProtocol || unitDisk) {
+            Ipv4AddressHelper groundAddress;
+            groundAddress.SetBase("10.1.0.0", "255.255.0.0");
+            groundInterfaces = groundAddress.Assign(groundDevices);
+        } else {
+            groundInterfaces = groundRadioHelper.AssignAddresses();
+        }
         std::cout << "  ✓ Ground IP addresses: " << groundInterfaces.GetN() << " (10.1.0.x)\n";
     }
 
     // ISL network creation (Steps 5-7, skip if ground-only mode)
     NetDeviceContainer islDevices;
     Ipv4InterfaceContainer islInterfaces;
+    IslNetworkCreator creator;  // Outlives the run: failure events reinstall routes through it
+    bool islFailuresEnabled = !groundOnly && (!islFailures.empty() || islMtbf > 0.0);
+    std::unique_ptr<IncrementalIslRoutes> incrementalRoutes;
+    IslFailureInjector failureInjector;
+    bool islTableForwarding = !groundOnly && islRouting == "static" && islForwarding != "static";
+    std::shared_ptr<IslNextHopTable> islNextHops;
+    IslTableRoutingHelper islTableRouting;
+    IslSourceRoutingHelper islSourceRouting;
+    const bool islTeEnabled = !groundOnly && islTe;
+    IslTrafficEngineering islTrafficEngineering;  // Outlives the run: waits for its worker on destruction
+    bool islSnapshotForwarding = islTableForwarding && islForwarding == "snapshot";
+    const bool islGeometric = !groundOnly && islRouting == "geometric";
+    GeometricIslRoutingHelper islGeometricRouting(NUM_PLANES, SATS_PER_PLANE);
+    std::unique_ptr<IslSnapshotRouting> islSnapshots;
+    IslRouteTableCache routeCache(routeCacheDir);
+    bool islLinkStatsEnabled = !groundOnly && !islLinkStats.empty();
+    IslLinkMonitor islLinkMonitor;
+    IslQueueDiscs islQueueDiscs;
+    const bool islPrioQdisc = !groundOnly && islQdisc == "prio";
     if (!groundOnly) {
         // Step 5: Create ISL mesh with PointToPoint links
         std::cout << "[5/9] Creating ISL mesh with distance-based delays...\n";
-        IslNetworkCreator creator;
         islDevices = creator.CreateIslMesh(satNodes, topology);
-        std::cout << "  ✓ ISL devices: " << islDevices.GetN() << " (48 links × 2 devices/link)\n";
+        std::cout << "  ✓ ISL devices: " << islDevices.GetN() << " (" << topology.numLinks << " links × 2 devices/link)\n";
+        if (islPrioQdisc) {
+            // Before address assignment, which would install the default queue disc
+            islQueueDiscs.Install(islDevices);
+            std::cout << "  ✓ ISL queue disc: strict priority for routing control, FQ-CoDel for data\n";
+        }
 
         // Step 6: Assign IP addresses
         std::cout << "[6/9] Assigning IP addresses to ISL links...\n";
         islInterfaces = creator.AssignIslAddresses(islDevices);
         std::cout << "  ✓ ISL interfaces: " << islInterfaces.GetN() << "\n";
 
+        // Per-link load and queue monitoring (queue discs exist once addresses are assigned)
+        if (islLinkStatsEnabled) {
+            islLinkMonitor.Install(topology, islDevices, Seconds(islLinkInterval),
+                                   islLinkStats + "_timeseries.csv");
+            std::cout << "  ✓ ISL link monitor: " << islLinkMonitor.GetNumDirections()
+                      << " link directions, sampled every " << islLinkInterval << "s\n";
+        }
+
         // Step 7: Install routes (if static) or wait for convergence (if dynamic)
         std::cout << "[7/9] Route installation...\n";
-        if (islRouting == "static") {
+        if (islSnapshotForwarding) {
+            // Snapshot forwarding: per-snapshot delay-weighted tables precomputed here and
+            // switched at every snapshot boundary; no host routes (connected routes only)
+            creator.RecordIslLinks(satNodes, islInterfaces);
+            islSnapshots = std::make_unique<IslSnapshotRouting>(constellation, topology);
+            islSnapshots->SetMaxInterPlaneLatitude(islMaxInterPlaneLat);
+            if (!routeCacheDir.empty()) {
+                islSnapshots->SetRouteCache(&routeCache);
+            }
+            islSnapshots->Precompute(islSnapshotInterval, simTime);
+            islTableRouting.Install(satNodes, topology, creator, islSnapshots->GetTable(0));
+            islSnapshots->Install(satNodes, islDevices, &islTableRouting);
+            std::cout << "  ✓ ISL snapshot forwarding installed (" << islSnapshots->GetNumSnapshots()
+                      << " snapshots × " << islSnapshotInterval << "s, "
+                      << (islSnapshots->IsCacheHit() ? "loaded from route cache" : "precomputed") << ")\n";
+        } else if (islRouting == "static" && (islFailuresEnabled || islTableForwarding)) {
+            // Static routing with failures or table forwarding: keep per-source trees for
+            // incremental repair (identical tables to ComputeStaticRoutes while all links are up)
+            incrementalRoutes = std::make_unique<IncrementalIslRoutes>(topology);
+            if (islForwarding == "source") {
+                // Source routing needs no per-satellite host routes: connected routes only
+                creator.RecordIslLinks(satNodes, islInterfaces);
+                std::cout << "  ✓ Static routes computed (incremental repair enabled, no host routes)\n";
+            } else {
+                creator.InstallStaticRoutes(satNodes, incrementalRoutes->GetRoutingTables(), islInterfaces);
+                std::cout << "  ✓ Static routes computed and installed (incremental repair enabled)\n";
+            }
+
+            if (islTableForwarding) {
+                // Table forwarding on top of the static host routes (kept as fallback, except in source mode)
+                bool ecmp = (islForwarding == "ecmp");
+                islNextHops = std::make_shared<IslNextHopTable>(topology.numSatellites);
+                incrementalRoutes->FillNextHopTable(*islNextHops, ecmp);
+                if (islForwarding == "source") {
+                    // Paths stamped at the ingress from the same table; transit is table-free
+                    islSourceRouting.Install(satNodes, topology, creator, islNextHops);
+                } else {
+                    islTableRouting.Install(satNodes, topology, creator, islNextHops);
+                }
+                failureInjector.SetRoutesChangedCallback([&incrementalRoutes, &islNextHops, ecmp]() {
+                    incrementalRoutes->RefreshNextHopTable(*islNextHops, ecmp);
+                });
+                std::cout << "  ✓ ISL " << islForwarding << " forwarding installed ("
+                          << islNextHops->CountMultipathPairs() << " multipath src/dst pairs)\n";
+
+                if (islTeEnabled) {
+                    // Load-aware re-weighting: recomputed tables replace the hop-count table
+                    islTrafficEngineering.SetThresholds(islTeHigh, islTeLow);
+                    islTrafficEngineering.SetPenalty(islTePenalty);
+                    islTrafficEngineering.Install(topology, islDevices, Seconds(islTeInterval),
+                        [&islForwarding, &islTableRouting, &islSourceRouting](std::shared_ptr<const IslNextHopTable> table) {
+                            if (islForwarding == "source") {
+                                islSourceRouting.SetTable(table);
+                            } else {
+                                islTableRouting.SetTable(table);
+                            }
+                        });
+                    std::cout << "  ✓ ISL traffic engineering every " << islTeInterval << "s (congested ≥ "
+                              << islTeHigh << ", cleared ≤ " << islTeLow << ", penalty " << islTePenalty << ")\n";
+                }
+            }
+        } else if (islGeometric) {
+            // Geometric forwarding: next hop from satellite IDs, detours around links that are down
+            creator.RecordIslLinks(satNodes, islInterfaces);
+            islGeometricRouting.Install(satNodes, topology, creator);
+            std::cout << "  ✓ Geometric +Grid forwarding installed (" << NUM_PLANES << " planes × "
+                      << SATS_PER_PLANE << ", no routing state)\n";
+        } else if (islRouting == "static") {
             // Static routing: compute and install routes
             RoutingTables routes = ComputeStaticRoutes(topology);
             creator.InstallStaticRoutes(satNodes, routes, islInterfaces);
@@ -405,6 +862,55 @@ int main(int argc, char *argv[]) {
             // Dynamic routing: OLSR/AODV will auto-discover routes
             std::cout << "  ✓ Dynamic routing will discover routes during simulation\n";
         }
+
+        // Step 7a: ISL failure injection (optional)
+        if (islFailuresEnabled) {
+            std::cout << "[7a/9] Scheduling ISL failures...\n";
+            if (!islFailures.empty() && !failureInjector.LoadSchedule(islFailures)) {
+                std::cerr << "ERROR: Cannot load ISL failure schedule: " << islFailures << "\n";
+                return 1;
+            }
+            if (islMtbf > 0.0) {
+                failureInjector.GenerateRandomSchedule(topology, islMtbf, islMttr, CONVERGENCE_TIME, simTime,
+                    crn ? RngStreamPlan::GetStream(RngStreamPlan::ISL_FAILURES, 0) : -1);
+            }
+            // Source mode has no host routes to update; the table refresh callback covers it
+            failureInjector.Install(topology, islDevices, islForwarding == "source" ? nullptr : &creator,
+                                    incrementalRoutes.get());
+            std::cout << "  ✓ " << failureInjector.GetScheduledEvents() << " ISL failure events scheduled\n";
+        }
+    }
+
+    // Step 7b: Gateway handover schedule from precomputed visibility windows (optional)
+    // Serving-satellite changes are exact rise/set times scheduled as events (no polling).
+    // Schedule only: there is no gateway node, so the events count and log the changes
+    // (gw_serving_changes, gw_coverage) without re-attaching or re-routing anything.
+    bool gatewayEnabled = !groundOnly && !gatewaySite.empty();
+    VisibilityWindowTable gatewayTable(constellation, gatewayMask);
+    std::vector<VisibilityWindowTable::Handover> gatewaySchedule;
+    uint32_t gatewayHandoverEvents = 0;
+    if (gatewayEnabled) {
+        std::cout << "[7b/9] Computing gateway visibility windows...\n";
+        uint32_t site = gatewayTable.AddSite(gatewayLat, gatewayLon);
+        bool loaded = !gatewayWindows.empty() && gatewayTable.Load(gatewayWindows, 0.0, simTime);
+        if (!loaded) {
+            gatewayTable.Compute(0.0, simTime);
+            if (!gatewayWindows.empty() && !gatewayTable.Save(gatewayWindows)) {
+                std::cerr << "WARNING: Cannot write gateway visibility windows: " << gatewayWindows << "\n";
+            }
+        }
+        gatewaySchedule = gatewayTable.GetServingSchedule(site);
+        for (const VisibilityWindowTable::Handover& handover : gatewaySchedule) {
+            Simulator::Schedule(Seconds(handover.time), [handover, &gatewayHandoverEvents]() {
+                gatewayHandoverEvents++;
+                NS_LOG_INFO("t=" << handover.time << "s: gateway serving satellite "
+                    << (handover.sat == UINT32_MAX ? std::string("none") : std::to_string(handover.sat)));
+            });
+        }
+        std::cout << "  ✓ Gateway (" << gatewayLat << ", " << gatewayLon << "): "
+                  << gatewayTable.GetNumWindows() << " passes above " << gatewayMask << "°, "
+                  << gatewaySchedule.size() << " serving changes scheduled"
+                  << (loaded ? " (windows loaded)" : "") << "\n";
     }
 
     // Step 8: Create test traffic (reuse from baselines)
@@ -412,178 +918,150 @@ int main(int argc, char *argv[]) {
 
     uint16_t basePort = 9;
 
+    // Test flows: sinks listen from t=0, senders start after routing convergence
+    // (fixed warm-up, or measured by the convergence monitor)
+    struct FlowSpec {
+        Ptr<Node> source;
+        Ptr<Node> sink;
+        Ipv4Address destination;
+        uint16_t port;
+        std::string rate;
+        bool warmup;  // Layer protocol needs route convergence (not reactive)
+    };
+    std::vector<FlowSpec> flows;
+
     // Satellite traffic (skip if ground-only mode)
     if (!groundOnly) {
+        bool islWarmup = islProtocol->GetCategory() != "reactive";
+
         // Test 1: Single-hop ISL (Sat 0 → Sat 1, direct neighbors)
-        Ipv4Address sat0Addr = satNodes.Get(0)->GetObject<Ipv4>()->GetAddress(1, 0).GetLocal();
         Ipv4Address sat1Addr = satNodes.Get(1)->GetObject<Ipv4>()->GetAddress(1, 0).GetLocal();
+        Ipv4Address sat0Addr = satNodes.Get(0)->GetObject<Ipv4>()->GetAddress(1, 0).GetLocal();
         std::cout << "  Sat flow 1: " << sat0Addr << " → " << sat1Addr << " (port " << basePort << ")\n";
-        OnOffHelper onoff1("ns3::UdpSocketFactory", InetSocketAddress(sat1Addr, basePort));
-        onoff1.SetConstantRate(DataRate("10Mbps"));
-        ApplicationContainer senderApps1 = onoff1.Install(satNodes.Get(0));
-        std::cout << "    Installed " << senderApps1.GetN() << " sender apps\n";
-        senderApps1.Start(Seconds(20.0));  // Start after convergence (if dynamic)
-        senderApps1.Stop(Seconds(simTime - 10.0));
-
-        PacketSinkHelper sink1("ns3::UdpSocketFactory",
-            InetSocketAddress(Ipv4Address::GetAny(), basePort));
-        ApplicationContainer sinkApps1 = sink1.Install(satNodes.Get(1));
-        sinkApps1.Start(Seconds(0.0));
+        flows.push_back({satNodes.Get(0), satNodes.Get(1), sat1Addr, basePort, "10Mbps", islWarmup});
 
         // Test 2: Multi-hop ISL (Sat 0 → Sat 23, diagonal opposite)
         Ipv4Address sat23Addr = satNodes.Get(23)->GetObject<Ipv4>()->GetAddress(1, 0).GetLocal();
-        OnOffHelper onoff2("ns3::UdpSocketFactory", InetSocketAddress(sat23Addr, basePort + 1));
-        onoff2.SetConstantRate(DataRate("10Mbps"));
-        ApplicationContainer senderApps2 = onoff2.Install(satNodes.Get(0));
-        senderApps2.Start(Seconds(20.0));
-        senderApps2.Stop(Seconds(simTime - 10.0));
-
-        PacketSinkHelper sink2("ns3::UdpSocketFactory",
-            InetSocketAddress(Ipv4Address::GetAny(), basePort + 1));
-        ApplicationContainer sinkApps2 = sink2.Install(satNodes.Get(23));
-        sinkApps2.Start(Seconds(0.0));
-    }
-
-    // Additional satellite flows for satellite-only mode (total 5 flows)
-    if (satelliteOnly) {
-        std::cout << "  Satellite-only mode: Adding 3 additional ISL flows (total 5)...\n";
-
-        // Flow 3: Sat 3 → Sat 10
-        Ipv4Address sat10Addr = satNodes.Get(10)->GetObject<Ipv4>()->GetAddress(1, 0).GetLocal();
-        OnOffHelper onoff3("ns3::UdpSocketFactory", InetSocketAddress(sat10Addr, basePort + 2));
-        onoff3.SetConstantRate(DataRate("10Mbps"));
-        ApplicationContainer satSenderApps3 = onoff3.Install(satNodes.Get(3));
-        satSenderApps3.Start(Seconds(20.0));
-        satSenderApps3.Stop(Seconds(simTime - 10.0));
-
-        PacketSinkHelper sink3("ns3::UdpSocketFactory",
-            InetSocketAddress(Ipv4Address::GetAny(), basePort + 2));
-        ApplicationContainer satSinkApps3 = sink3.Install(satNodes.Get(10));
-        satSinkApps3.Start(Seconds(0.0));
-
-        // Flow 4: Sat 6 → Sat 13
-        Ipv4Address sat13Addr = satNodes.Get(13)->GetObject<Ipv4>()->GetAddress(1, 0).GetLocal();
-        OnOffHelper onoff4("ns3::UdpSocketFactory", InetSocketAddress(sat13Addr, basePort + 3));
-        onoff4.SetConstantRate(DataRate("10Mbps"));
-        ApplicationContainer satSenderApps4 = onoff4.Install(satNodes.Get(6));
-        satSenderApps4.Start(Seconds(20.0));
-        satSenderApps4.Stop(Seconds(simTime - 10.0));
-
-        PacketSinkHelper sink4("ns3::UdpSocketFactory",
-            InetSocketAddress(Ipv4Address::GetAny(), basePort + 3));
-        ApplicationContainer satSinkApps4 = sink4.Install(satNodes.Get(13));
-        satSinkApps4.Start(Seconds(0.0));
-
-        // Flow 5: Sat 9 → Sat 20
-        Ipv4Address sat20Addr = satNodes.Get(20)->GetObject<Ipv4>()->GetAddress(1, 0).GetLocal();
-        OnOffHelper onoff5("ns3::UdpSocketFactory", InetSocketAddress(sat20Addr, basePort + 4));
-        onoff5.SetConstantRate(DataRate("10Mbps"));
-        ApplicationContainer satSenderApps5 = onoff5.Install(satNodes.Get(9));
-        satSenderApps5.Start(Seconds(20.0));
-        satSenderApps5.Stop(Seconds(simTime - 10.0));
-
-        PacketSinkHelper sink5("ns3::UdpSocketFactory",
-            InetSocketAddress(Ipv4Address::GetAny(), basePort + 4));
-        ApplicationContainer satSinkApps5 = sink5.Install(satNodes.Get(20));
-        satSinkApps5.Start(Seconds(0.0));
+        flows.push_back({satNodes.Get(0), satNodes.Get(23), sat23Addr, static_cast<uint16_t>(basePort + 1), "10Mbps", islWarmup});
+
+        // Additional satellite flows for satellite-only mode (total 5 flows)
+        if (satelliteOnly) {
+            std::cout << "  Satellite-only mode: Adding 3 additional ISL flows (total 5)...\n";
+            const uint32_t extraFlows[3][2] = {
+                {3, 10},  // Flow 3: Sat 3 → Sat 10
+                {6, 13},  // Flow 4: Sat 6 → Sat 13
+                {9, 20},  // Flow 5: Sat 9 → Sat 20
+            };
+            for (uint32_t f = 0; f < 3; ++f) {
+                Ptr<Node> dst = satNodes.Get(extraFlows[f][1]);
+                Ipv4Address dstAddr = dst->GetObject<Ipv4>()->GetAddress(1, 0).GetLocal();
+                flows.push_back({satNodes.Get(extraFlows[f][0]), dst, dstAddr,
+                                 static_cast<uint16_t>(basePort + 2 + f), "10Mbps", islWarmup});
+            }
+        }
     }
 
     // Test 3: Ground mesh traffic (if ground layer enabled and not satellite-only mode)
     if (groundNodes > 0 && !satelliteOnly) {
+        bool groundWarmup = groundProtocol->GetCategory() != "reactive";
         uint32_t destNode = groundNodes - 1;  // Last ground node
 
-        // Get destination address from ground interface container
-        Ipv4Address meshDestAddr = groundInterfaces.GetAddress(destNode);
-        Ipv4Address meshSrcAddr = groundInterfaces.GetAddress(0);
-
-        std::cout << "  Ground mesh flow: " << meshSrcAddr << " → " << meshDestAddr << "\n";
-
-        OnOffHelper onoff3("ns3::UdpSocketFactory", InetSocketAddress(meshDestAddr, basePort + 2));
-        onoff3.SetConstantRate(DataRate("1Mbps"));  // Lower rate for ground mesh
-        ApplicationContainer senderApps3 = onoff3.Install(meshNodes.Get(0));
-        senderApps3.Start(Seconds(20.0));
-        senderApps3.Stop(Seconds(simTime - 10.0));
-
-        PacketSinkHelper sink3("ns3::UdpSocketFactory",
-            InetSocketAddress(Ipv4Address::GetAny(), basePort + 2));
-        ApplicationContainer sinkApps3 = sink3.Install(meshNodes.Get(destNode));
-        sinkApps3.Start(Seconds(0.0));
-
-        // Flow 2: Node 5 → Node 14 (mid-range, tests different spatial region)
-        if (groundNodes > 14) {
-            Ipv4Address dest2 = groundInterfaces.GetAddress(14);
-            Ipv4Address src2 = groundInterfaces.GetAddress(5);
-
-            std::cout << "  Ground mesh flow 2: " << src2 << " → " << dest2 << "\n";
-
-            OnOffHelper onoff4("ns3::UdpSocketFactory", InetSocketAddress(dest2, basePort + 3));
-            onoff4.SetConstantRate(DataRate("1Mbps"));
-            ApplicationContainer senderApps4 = onoff4.Install(meshNodes.Get(5));
-            senderApps4.Start(Seconds(20.0));
-            senderApps4.Stop(Seconds(simTime - 10.0));
-
-            PacketSinkHelper sink4("ns3::UdpSocketFactory",
-                InetSocketAddress(Ipv4Address::GetAny(), basePort + 3));
-            ApplicationContainer sinkApps4 = sink4.Install(meshNodes.Get(14));
-            sinkApps4.Start(Seconds(0.0));
+        // Flow 1: Node 0 → last node
+        std::cout << "  Ground mesh flow: " << groundInterfaces.GetAddress(0) << " → "
+                  << groundInterfaces.GetAddress(destNode) << "\n";
+        flows.push_back({meshNodes.Get(0), meshNodes.Get(destNode), groundInterfaces.GetAddress(destNode),
+                         static_cast<uint16_t>(basePort + 2), "1Mbps", groundWarmup});
+
+        // Flows 2-5: mid-range and random pairs (only if the grid is large enough)
+        const uint32_t meshFlows[4][2] = {
+            {5, 14},  // Flow 2: Node 5 → Node 14 (mid-range, tests different spatial region)
+            {3, 17},  // Flow 3: Node 3 → Node 17 (random path)
+            {8, 12},  // Flow 4: Node 8 → Node 12 (random path)
+            {2, 18},  // Flow 5: Node 2 → Node 18 (random path)
+        };
+        for (uint32_t f = 0; f < 4; ++f) {
+            uint32_t src = meshFlows[f][0];
+            uint32_t dst = meshFlows[f][1];
+            if (groundNodes <= dst) continue;
+            std::cout << "  Ground mesh flow " << f + 2 << ": " << groundInterfaces.GetAddress(src)
+                      << " → " << groundInterfaces.GetAddress(dst) << "\n";
+            flows.push_back({meshNodes.Get(src), meshNodes.Get(dst), groundInterfaces.GetAddress(dst),
+                             static_cast<uint16_t>(basePort + 3 + f), "1Mbps", groundWarmup});
         }
+    }
 
-        // Flow 3: Node 3 → Node 17 (random path)
-        if (groundNodes > 17) {
-            Ipv4Address dest3 = groundInterfaces.GetAddress(17);
-            Ipv4Address src3 = groundInterfaces.GetAddress(3);
-
-            std::cout << "  Ground mesh flow 3: " << src3 << " → " << dest3 << "\n";
-
-            OnOffHelper onoff5("ns3::UdpSocketFactory", InetSocketAddress(dest3, basePort + 4));
-            onoff5.SetConstantRate(DataRate("1Mbps"));
-            ApplicationContainer senderApps5 = onoff5.Install(meshNodes.Get(3));
-            senderApps5.Start(Seconds(20.0));
-            senderApps5.Stop(Seconds(simTime - 10.0));
-
-            PacketSinkHelper sink5("ns3::UdpSocketFactory",
-                InetSocketAddress(Ipv4Address::GetAny(), basePort + 4));
-            ApplicationContainer sinkApps5 = sink5.Install(meshNodes.Get(17));
-            sinkApps5.Start(Seconds(0.0));
+    // Application start/stop are delays from the time the application is installed
+    // (t=0 for the fixed warm-up; the convergence decision time for adaptive mode)
+    const double trafficStop = simTime - END_BUFFER;
+    // Lean traffic tags packets with the flow's index in flows (also the flow's CRN stream slot)
+    ApplicationContainer senderApps;
+    ApplicationContainer sinkApps;
+    LeanUdpHelper lean;
+    lean.SetBurstSize(trafficBurst);
+    lean.SetPoisson(trafficArrivals == "poisson");
+    auto installSender = [trafficStop, &senderApps, &flows, leanTraffic, &lean, crn](const FlowSpec& flow, double start) {
+        const uint32_t flowIndex = static_cast<uint32_t>(&flow - flows.data());
+        ApplicationContainer apps;
+        if (leanTraffic) {
+            lean.SetRate(DataRate(flow.rate));
+            apps = lean.InstallSource(flow.source, InetSocketAddress(flow.destination, flow.port), flowIndex);
+        } else {
+            OnOffHelper onoff("ns3::UdpSocketFactory", InetSocketAddress(flow.destination, flow.port));
+            onoff.SetConstantRate(DataRate(flow.rate));
+            apps = onoff.Install(flow.source);
         }
-
-        // Flow 4: Node 8 → Node 12 (random path)
-        if (groundNodes > 12) {
-            Ipv4Address dest4 = groundInterfaces.GetAddress(12);
-            Ipv4Address src4 = groundInterfaces.GetAddress(8);
-
-            std::cout << "  Ground mesh flow 4: " << src4 << " → " << dest4 << "\n";
-
-            OnOffHelper onoff6("ns3::UdpSocketFactory", InetSocketAddress(dest4, basePort + 5));
-            onoff6.SetConstantRate(DataRate("1Mbps"));
-            ApplicationContainer senderApps6 = onoff6.Install(meshNodes.Get(8));
-            senderApps6.Start(Seconds(20.0));
-            senderApps6.Stop(Seconds(simTime - 10.0));
-
-            PacketSinkHelper sink6("ns3::UdpSocketFactory",
-                InetSocketAddress(Ipv4Address::GetAny(), basePort + 5));
-            ApplicationContainer sinkApps6 = sink6.Install(meshNodes.Get(12));
-            sinkApps6.Start(Seconds(0.0));
+        if (crn) {
+            RngStreamPlan::Assign(RngStreamPlan::TRAFFIC, flowIndex, [&apps](int64_t stream) {
+                return apps.Get(0)->AssignStreams(stream);
+            });
         }
-
-        // Flow 5: Node 2 → Node 18 (random path)
-        if (groundNodes > 18) {
-            Ipv4Address dest5 = groundInterfaces.GetAddress(18);
-            Ipv4Address src5 = groundInterfaces.GetAddress(2);
-
-            std::cout << "  Ground mesh flow 5: " << src5 << " → " << dest5 << "\n";
-
-            OnOffHelper onoff7("ns3::UdpSocketFactory", InetSocketAddress(dest5, basePort + 6));
-            onoff7.SetConstantRate(DataRate("1Mbps"));
-            ApplicationContainer senderApps7 = onoff7.Install(meshNodes.Get(2));
-            senderApps7.Start(Seconds(20.0));
-            senderApps7.Stop(Seconds(simTime - 10.0));
-
-            PacketSinkHelper sink7("ns3::UdpSocketFactory",
-                InetSocketAddress(Ipv4Address::GetAny(), basePort + 6));
-            ApplicationContainer sinkApps7 = sink7.Install(meshNodes.Get(18));
-            sinkApps7.Start(Seconds(0.0));
+        apps.Start(Seconds(start) - Simulator::Now());
+        apps.Stop(Seconds(trafficStop) - Simulator::Now());
+        senderApps.Add(apps);
+    };
+    auto installSink = [&sinkApps, leanTraffic, &lean](const FlowSpec& flow) {
+        ApplicationContainer apps;
+        if (leanTraffic) {
+            apps = lean.InstallSink(flow.sink, flow.port);
+        } else {
+            PacketSinkHelper sink("ns3::UdpSocketFactory", InetSocketAddress(Ipv4Address::GetAny(), flow.port));
+            apps = sink.Install(flow.sink);
+        }
+        apps.Start(Seconds(0.0));
+        sinkApps.Add(apps);
+    };
+
+    // Steady-state stop: batches start with the traffic (metrics are added after Step 9)
+    SteadyStateController steady(Seconds(steadyBatch), steadyTarget);
+
+    ConvergenceMonitor convergence(Seconds(convergenceCheck), Seconds(convergenceHold),
+                                   Seconds(std::min(CONVERGENCE_TIME, simTime - END_BUFFER - MIN_TRAFFIC_DURATION)));
+    if (!adaptiveConvergence) {
+        // Fixed warm-up (sender then sink per flow, as in the published runs)
+        for (const FlowSpec& flow : flows) {
+            installSender(flow, CONVERGENCE_TIME);
+            installSink(flow);
         }
+        if (steadyStateEnabled) {
+            Simulator::Schedule(Seconds(CONVERGENCE_TIME), &SteadyStateController::Start, &steady);
+        }
+    } else {
+        for (const FlowSpec& flow : flows) {
+            installSink(flow);
+            if (flow.warmup) {
+                convergence.AddPair(flow.source, flow.destination);
+            }
+        }
+        convergence.SetConvergedCallback([&flows, installSender, &steady, steadyStateEnabled](Time now) {
+            std::cout << "  ✓ Routes ready at t=" << now.GetSeconds() << "s: starting " << flows.size() << " flows\n";
+            for (const FlowSpec& flow : flows) {
+                installSender(flow, now.GetSeconds());
+            }
+            if (steadyStateEnabled) {
+                steady.Start();
+            }
+        });
+        convergence.Start();
     }
 
     std::cout << "  ✓ Test traffic configured:\n";
@@ -592,7 +1070,13 @@ int main(int argc, char *argv[]) {
     if (groundNodes > 0) {
         std::cout << "    - Mesh flows: 5 random pairs (multi-hop ground, 1 Mbps UDP each)\n";
     }
-    std::cout << "  ✓ Traffic starts at t=20s (allows convergence for dynamic protocols)\n";
+    if (adaptiveConvergence) {
+        std::cout << "  ✓ Traffic starts once " << convergence.GetNumPairs() << " flow routes are stable for "
+                  << convergenceHold << "s (at the latest t="
+                  << std::min(CONVERGENCE_TIME, simTime - END_BUFFER - MIN_TRAFFIC_DURATION) << "s)\n";
+    } else {
+        std::cout << "  ✓ Traffic starts at t=20s (allows convergence for dynamic protocols)\n";
+    }
     std::cout << "\n=== DIAGNOSTIC: Application Install Time ===\n";
     std::cout << "  Current simulation time: " << Simulator::Now().GetSeconds() << "s\n";
 
@@ -605,13 +1089,27 @@ int main(int argc, char *argv[]) {
     std::cout << "\n=== DIAGNOSTIC: FlowMonitor Install Time ===\n";
     std::cout << "  Current simulation time: " << Simulator::Now().GetSeconds() << "s\n";
 
-    // Phase 6 Week 27: Install PacketTracer for NRL metrics (ground layer only)
-    // Note: HWMP excluded from NRL tracking (FlowMonitor incompatibility already excludes it from final experiments)
+    // Phase 6 Week 27: Install PacketTracer for NRL metrics, per layer (one hookup per node)
+    // HWMP control traffic never reaches IP: its mesh devices count frames at layer 2
     PacketTracer tracer;
-    if (groundNodes > 0 && groundRouting != "hwmp") {
-        tracer.Install(groundDevices);
+    if (islDevices.GetN() > 0) {
+        tracer.Install(islDevices, PacketTracer::ISL);
+        std::cout << "  ✓ PacketTracer installed on " << islDevices.GetN() << " ISL devices\n";
+    }
+    if (groundNodes > 0 && !hwmpProtocol) {
+        tracer.Install(groundDevices, PacketTracer::GROUND);
         std::cout << "  ✓ PacketTracer installed on " << groundDevices.GetN() << " ground devices\n";
+    } else if (hwmpProtocol) {
+        std::cout << "  ✓ MeshFrameTracer on " << groundDevices.GetN() << " mesh point devices (layer-2 NRL)\n";
     }
+    auto groundControlBytesTx = [&tracer, hwmpProtocol]() {
+        return hwmpProtocol ? hwmpProtocol->GetFrameTracer().GetControlBytesTx()
+                            : tracer.GetControlBytesTx(PacketTracer::GROUND);
+    };
+    auto groundDataBytesTx = [&tracer, hwmpProtocol]() {
+        return hwmpProtocol ? hwmpProtocol->GetFrameTracer().GetDataBytesTx()
+                            : tracer.GetDataBytesTx(PacketTracer::GROUND);
+    };
 
 
     // Log initial and final positions to verify movement (waypoint mode only)
@@ -675,8 +1173,72 @@ int main(int argc, char *argv[]) {
     std::cout << "  Current simulation time: " << Simulator::Now().GetSeconds() << "s\n";
     auto startTime = std::chrono::high_resolution_clock::now();
 
+    // Steady-state stop: track PDR, delay and NRL per batch; once precise, stop the
+    // senders (OnOff stops after its next packet once MaxBytes is reached) and drain
+    if (steadyStateEnabled) {
+        auto flowTotals = [monitor]() {
+            double tx = 0.0, rx = 0.0, delay = 0.0;
+            for (const auto& [flowId, flowStats] : monitor->GetFlowStats()) {
+                tx += flowStats.txPackets;
+                rx += flowStats.rxPackets;
+                delay += flowStats.delaySum.GetSeconds();
+            }
+            return std::make_tuple(tx, rx, delay);
+        };
+        steady.AddRatioMetric("pdr", [flowTotals]() {
+            auto [tx, rx, delay] = flowTotals();
+            return std::make_pair(rx, tx);
+        });
+        steady.AddRatioMetric("delay", [flowTotals]() {
+            auto [tx, rx, delay] = flowTotals();
+            return std::make_pair(delay, rx);
+        });
+        if (groundNodes > 0) {
+            steady.AddRatioMetric("nrl", [groundControlBytesTx, groundDataBytesTx]() {
+                return std::make_pair(static_cast<double>(groundControlBytesTx()),
+                                      static_cast<double>(groundDataBytesTx()));
+            });
+        }
+        steady.SetStopCallback([&senderApps, steadyDrain]() {
+            std::cout << "  ✓ Steady state at t=" << Simulator::Now().GetSeconds() << "s: stopping senders, "
+                      << steadyDrain << "s drain\n";
+            for (uint32_t i = 0; i < senderApps.GetN(); ++i) {
+                senderApps.Get(i)->SetAttributeFailSafe("MaxBytes", UintegerValue(1));
+            }
+            Simulator::Stop(Seconds(steadyDrain));
+        });
+        std::cout << "  ✓ Steady-state stop: target relative CI half-width " << steadyTarget
+                  << ", " << steadyBatch << "s batches (MSER-5)\n";
+    }
+
+    // Live status for run-monitor: progress, event rate, RSS and current PDR/NRL
+    RunTelemetry telemetry;
+    if (!telemetryDir.empty()) {
+        std::ostringstream label;
+        label << (satelliteOnly ? "" : groundRouting + "-n" + std::to_string(groundNodes) + "-")
+              << (groundOnly ? "" : "isl-" + islRouting + "-") << "s" << seed;
+        if (telemetry.Open(telemetryDir, label.str(), simTime)) {
+            telemetry.SetMetrics([monitor, groundNodes, groundControlBytesTx, groundDataBytesTx]() {
+                double tx = 0.0, rx = 0.0;
+                for (const auto& [flowId, flowStats] : monitor->GetFlowStats()) {
+                    tx += flowStats.txPackets;
+                    rx += flowStats.rxPackets;
+                }
+                double dataBytes = groundNodes > 0 ? static_cast<double>(groundDataBytesTx()) : 0.0;
+                return std::make_pair(tx > 0.0 ? 100.0 * rx / tx : -1.0,
+                                      dataBytes > 0.0 ? groundControlBytesTx() / dataBytes : -1.0);
+            });
+            telemetry.Start(MilliSeconds(100), telemetryInterval);
+            std::cout << "  ✓ Live status: " << telemetry.GetPath() << " (every " << telemetryInterval << "s)\n";
+        } else {
+            std::cerr << "WARNING: Could not create live status in " << telemetryDir << "\n";
+        }
+    }
+
     Simulator::Stop(Seconds(simTime));
     Simulator::Run();
+    const double simulatedTime = Simulator::Now().GetSeconds();
+    telemetry.Finish();
 
     auto endTime = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime).count();
@@ -727,9 +1289,11 @@ int main(int argc, char *argv[]) {
     std::cout << "PDR: " << std::fixed << std::setprecision(2) << pdr << "%\n";
     std::cout << "Avg delay: " << avgDelay << " ms\n\n";
 
-    // Export to CSV
+    // Export to CSV (written to a temporary file and renamed into place, so
+    // aggregate-results in watch mode never sees a partially written run)
     std::cout << "=== Exporting Results ===\n";
-    std::ofstream csv(outputFile);
+    const std::string tmpOutputFile = outputFile + ".tmp";
+    std::ofstream csv(tmpOutputFile);
     csv << "metric,value\n";
     if (!groundOnly) {
         csv << "isl_routing," << islProtocol->GetName() << "\n";
@@ -739,6 +1303,7 @@ int main(int argc, char *argv[]) {
         csv << "ground_routing," << groundProtocol->GetName() << "\n";
         csv << "ground_category," << groundProtocol->GetCategory() << "\n";
         csv << "ground_nodes," << groundNodes << "\n";
+        csv << "ground_mobility," << groundMobility << "\n";
     }
     csv << "satellites," << satellites << "\n";
     csv << "sim_time," << simTime << "\n";
@@ -749,11 +1314,175 @@ int main(int argc, char *argv[]) {
     csv << "pdr," << pdr << "\n";
     csv << "avg_delay_ms," << avgDelay << "\n";
     csv << "runtime_seconds," << duration << "\n";
+    if (islTableForwarding) {
+        csv << "isl_forwarding," << islForwarding << "\n";
+        if (islForwarding == "source") {
+            csv << "isl_source_stamped_packets," << islSourceRouting.GetStampedPackets() << "\n";
+            csv << "isl_source_transit_packets," << islSourceRouting.GetTransitPackets() << "\n";
+            csv << "isl_source_restamped_packets," << islSourceRouting.GetRestampedPackets() << "\n";
+            csv << "isl_source_unstamped_packets," << islSourceRouting.GetUnstampedPackets() << "\n";
+            csv << "isl_source_mean_path_hops," << islSourceRouting.GetMeanPathLength() << "\n";
+        } else {
+            csv << "isl_table_forwarded_packets," << islTableRouting.GetForwardedPackets() << "\n";
+        }
+    }
+    if (islTeEnabled) {
+        csv << "isl_te_recomputations," << islTrafficEngineering.GetRecomputations() << "\n";
+        csv << "isl_te_table_swaps," << islTrafficEngineering.GetTableSwaps() << "\n";
+        csv << "isl_te_link_state_changes," << islTrafficEngineering.GetStateChanges() << "\n";
+        csv << "isl_te_peak_congested_links," << islTrafficEngineering.GetPeakCongestedLinks() << "\n";
+        csv << "isl_te_wait_seconds," << islTrafficEngineering.GetWaitSeconds() << "\n";
+    }
+    if (islGeometric) {
+        csv << "isl_planes," << NUM_PLANES << "\n";
+        csv << "isl_geometric_forwarded_packets," << islGeometricRouting.GetForwardedPackets() << "\n";
+        csv << "isl_geometric_detours," << islGeometricRouting.GetDetours() << "\n";
+    }
+    if (islSnapshotForwarding) {
+        csv << "isl_snapshots," << islSnapshots->GetAppliedSnapshots() << "\n";
+        csv << "isl_snapshot_link_transitions," << islSnapshots->GetLinkTransitions() << "\n";
+        if (!routeCacheDir.empty()) {
+            csv << "isl_route_cache," << (islSnapshots->IsCacheHit() ? "hit" : "miss") << "\n";
+        }
+    }
+    if (gatewayEnabled) {
+        // Coverage: fraction of the run with a serving satellite
+        double covered = 0.0;
+        for (size_t i = 0; i < gatewaySchedule.size(); ++i) {
+            double end = i + 1 < gatewaySchedule.size() ? gatewaySchedule[i + 1].time : simTime;
+            if (gatewaySchedule[i].sat != UINT32_MAX) {
+                covered += end - gatewaySchedule[i].time;
+            }
+        }
+        csv << "gw_passes," << gatewayTable.GetNumWindows() << "\n";
+        csv << "gw_serving_changes," << gatewayHandoverEvents << "\n";
+        csv << "gw_coverage," << (simTime > 0.0 ? covered / simTime : 0.0) << "\n";
+    }
+    if (groundRadios > 1 && groundNodes > 0 && !satelliteOnly) {
+        csv << "ground_radios," << groundRadios << "\n";
+        csv << "ground_channels," << groundChannels << "\n";
+        csv << "ground_channel_assignment," << groundChannelAssignment << "\n";
+        csv << "ground_data_links," << groundRadioHelper.GetDataLinks() << "\n";
+    }
+    if (unitDisk && groundNodes > 0 && !satelliteOnly) {
+        UnitDiskHelper::Counters frames = UnitDiskHelper::GetCounters(groundDevices);
+        csv << "ground_phy,unitdisk\n";
+        csv << "unitdisk_tx_frames," << frames.txFrames << "\n";
+        csv << "unitdisk_retries," << frames.retries << "\n";
+        csv << "unitdisk_collisions," << frames.collisions << "\n";
+        csv << "unitdisk_queue_drops," << frames.queueDrops << "\n";
+        csv << "unitdisk_retry_drops," << frames.retryDrops << "\n";
+    }
+    if (groundLoss) {
+        csv << "ground_propagation," << groundPropagation << "\n";
+        if (propagationCache) {
+            uint64_t lookups = groundLoss->GetHits() + groundLoss->GetMisses();
+            csv << "propagation_cache_hits," << groundLoss->GetHits() << "\n";
+            csv << "propagation_cache_misses," << groundLoss->GetMisses() << "\n";
+            csv << "propagation_cache_hit_ratio,"
+                << (lookups > 0 ? static_cast<double>(groundLoss->GetHits()) / lookups : 0.0) << "\n";
+            std::cout << "Propagation cache: " << groundLoss->GetHits() << "/" << lookups << " hits, "
+                      << groundLoss->GetCachedPairs() << " pairs\n";
+        }
+    }
+    if (groundQosEnabled) {
+        csv << "ground_qos_control_ac," << qosControlAc << "\n";
+        csv << "ground_qos_data_ac," << qosDataAc << "\n";
+        for (uint32_t i = 0; i < GroundQosHelper::NUM_ACS; ++i) {
+            AcIndex ac = static_cast<AcIndex>(i);
+            const std::string name = "ground_ac_" + GroundQosHelper::GetAcName(ac);
+            csv << name << "_enqueued," << groundQosHelper.GetEnqueued(ac) << "\n";
+            csv << name << "_queue_drops," << groundQosHelper.GetQueueDrops(ac) << "\n";
+            csv << name << "_transmissions," << groundQosHelper.GetTransmissions(ac) << "\n";
+            csv << name << "_retries," << groundQosHelper.GetRetries(ac) << "\n";
+            csv << name << "_retry_drops," << groundQosHelper.GetRetryDrops(ac) << "\n";
+        }
+        std::cout << "Ground AC_" << qosControlAc << " (control): " << groundQosHelper.GetRetries(controlAc)
+                  << " retries, " << groundQosHelper.GetQueueDrops(controlAc) + groundQosHelper.GetRetryDrops(controlAc)
+                  << " drops\n";
+    }
+    if (islFailuresEnabled) {
+        csv << "isl_failure_events," << failureInjector.GetAppliedEvents() << "\n";
+        csv << "isl_route_updates," << failureInjector.GetRouteUpdates() << "\n";
+        if (incrementalRoutes) {
+            csv << "isl_tree_recomputations," << incrementalRoutes->GetTreeRecomputations() << "\n";
+        }
+    }
+    if (steadyStateEnabled) {
+        csv << "ss_steady," << (steady.IsSteady() ? 1 : 0) << "\n";
+        csv << "ss_simulated_time," << simulatedTime << "\n";
+        csv << "ss_batches," << steady.GetBatches() << "\n";
+        for (const SteadyStateController::Estimate& e : steady.GetEstimates()) {
+            csv << "ss_" << e.name << "_mean," << e.mean << "\n";
+            csv << "ss_" << e.name << "_halfwidth," << e.halfWidth << "\n";
+            csv << "ss_" << e.name << "_truncated_groups," << e.truncated << "\n";
+        }
+    }
+    if (crn) {
+        csv << "rng_streams,crn\n";
+    }
+    if (leanTraffic) {
+        // Sinks are installed in flow order (sink i receives flow ID i); senders only
+        // once their flow started
+        std::vector<uint32_t> leanSent(sinkApps.GetN(), 0);
+        for (uint32_t i = 0; i < senderApps.GetN(); ++i) {
+            Ptr<LeanUdpSource> source = DynamicCast<LeanUdpSource>(senderApps.Get(i));
+            if (source->GetFlowId() < leanSent.size()) {
+                leanSent[source->GetFlowId()] = source->GetSentPackets();
+            }
+        }
+        uint64_t leanRx = 0;
+        uint64_t leanLost = 0;
+        uint64_t leanReordered = 0;
+        uint64_t leanDuplicates = 0;
+        for (uint32_t i = 0; i < sinkApps.GetN(); ++i) {
+            Ptr<LeanUdpSink> sink = DynamicCast<LeanUdpSink>(sinkApps.Get(i));
+            leanRx += sink->GetReceivedPackets();
+            leanLost += sink->GetLostPackets(i, leanSent[i]);
+            leanReordered += sink->GetReorderedPackets();
+            leanDuplicates += sink->GetDuplicatePackets();
+        }
+        csv << "traffic,lean\n";
+        csv << "lean_rx_packets," << leanRx << "\n";
+        csv << "lean_lost_packets," << leanLost << "\n";
+        csv << "lean_reordered_packets," << leanReordered << "\n";
+        csv << "lean_duplicate_packets," << leanDuplicates << "\n";
+    }
+    if (adaptiveConvergence) {
+        csv << "convergence_time_s," << convergence.GetConvergenceTime().GetSeconds() << "\n";
+        csv << "traffic_start_s," << convergence.GetDecisionTime().GetSeconds() << "\n";
+        csv << "converged," << (convergence.HasConverged() ? 1 : 0) << "\n";
+    }
+    if (islLinkStatsEnabled) {
+        if (!islLinkMonitor.WriteSummary(islLinkStats + "_summary.csv")) {
+            std::cerr << "WARNING: Cannot write ISL link summary: " << islLinkStats << "_summary.csv\n";
+        }
+        uint32_t hotspot = islLinkMonitor.GetHotspotDirection();
+        if (hotspot != UINT32_MAX) {
+            const auto& [a, b] = topology.links[hotspot / 2];
+            std::cout << "ISL hotspot: Sat " << (hotspot % 2 == 0 ? a : b) << " → Sat "
+                      << (hotspot % 2 == 0 ? b : a) << "\n";
+        }
+        csv << "isl_peak_link_utilization," << islLinkMonitor.GetPeakUtilization() << "\n";
+        csv << "isl_queue_drops," << islLinkMonitor.GetTotalDrops() << "\n";
+    }
+    if (islPrioQdisc) {
+        csv << "isl_qdisc," << islQdisc << "\n";
+        for (auto c : {IslQueueDiscs::CONTROL, IslQueueDiscs::DATA}) {
+            const std::string name = c == IslQueueDiscs::CONTROL ? "isl_control" : "isl_data";
+            csv << name << "_queued_packets," << islQueueDiscs.GetPackets(c) << "\n";
+            csv << name << "_queue_drops," << islQueueDiscs.GetDrops(c) << "\n";
+            csv << name << "_sojourn_mean_ms," << islQueueDiscs.GetMeanSojourn(c).GetSeconds() * 1000.0 << "\n";
+            csv << name << "_sojourn_max_ms," << islQueueDiscs.GetMaxSojourn(c).GetSeconds() * 1000.0 << "\n";
+        }
+        std::cout << "ISL control band: " << islQueueDiscs.GetDrops(IslQueueDiscs::CONTROL) << " drops, max sojourn "
+                  << islQueueDiscs.GetMaxSojourn(IslQueueDiscs::CONTROL).GetSeconds() * 1000.0 << " ms\n";
+    }
 
     // Phase 6 Week 27: Add NRL metrics (if ground layer enabled)
     if (groundNodes > 0) {
-        uint64_t dataBytesTx = tracer.GetDataBytesTx();
-        uint64_t controlBytesTx = tracer.GetControlBytesTx();
+        uint64_t dataBytesTx = groundDataBytesTx();
+        uint64_t controlBytesTx = groundControlBytesTx();
         double nrl = (dataBytesTx > 0) ? (double)controlBytesTx / dataBytesTx : 0.0;
 
         csv << "data_bytes_tx," << dataBytesTx << "\n";
@@ -764,9 +1493,40 @@ int main(int argc, char *argv[]) {
         std::cout << "Data bytes TX: " << dataBytesTx << "\n";
         std::cout << "Control bytes TX: " << controlBytesTx << "\n";
         std::cout << "NRL: " << std::fixed << std::setprecision(4) << nrl << "\n";
+
+        if (hwmpProtocol) {
+            // Layer-2 breakdown (frame bodies; data as carried IP packets)
+            const MeshFrameTracer& frames = hwmpProtocol->GetFrameTracer();
+            for (uint32_t t = 0; t < MeshFrameTracer::NUM_FRAME_TYPES; ++t) {
+                auto type = static_cast<MeshFrameTracer::FrameType>(t);
+                csv << "mesh_" << MeshFrameTracer::GetTypeName(type) << "_frames," << frames.GetFrames(type) << "\n";
+                csv << "mesh_" << MeshFrameTracer::GetTypeName(type) << "_bytes," << frames.GetBytes(type) << "\n";
+                std::cout << "  " << MeshFrameTracer::GetTypeName(type) << ": " << frames.GetFrames(type)
+                          << " frames, " << frames.GetBytes(type) << " bytes\n";
+            }
+        }
+    }
+
+    // Per-layer overhead for the satellite layer (ground layer above)
+    if (islDevices.GetN() > 0) {
+        uint64_t islDataBytesTx = tracer.GetDataBytesTx(PacketTracer::ISL);
+        uint64_t islControlBytesTx = tracer.GetControlBytesTx(PacketTracer::ISL);
+        double islNrl = (islDataBytesTx > 0) ? (double)islControlBytesTx / islDataBytesTx : 0.0;
+
+        csv << "isl_data_bytes_tx," << islDataBytesTx << "\n";
+        csv << "isl_control_bytes_tx," << islControlBytesTx << "\n";
+        csv << "isl_nrl," << std::fixed << std::setprecision(6) << islNrl << "\n";
+
+        std::cout << "ISL data bytes TX: " << islDataBytesTx << ", control bytes TX: " << islControlBytesTx
+                  << ", NRL: " << std::fixed << std::setprecision(4) << islNrl << "\n";
     }
 
     csv.close();
+    if (!csv || std::rename(tmpOutputFile.c_str(), outputFile.c_str()) != 0) {
+        std::cerr << "ERROR: Cannot write results to " << outputFile << ": " << std::strerror(errno) << "\n";
+        Simulator::Destroy();
+        return 1;
+    }
 
     std::cout << "  ✓ Results exported to: " << outputFile << "\n\n";
 
@@ -0,0 +1,400 @@
+/**
+ * Unit-Disk Net Device Implementation
+ *
+ * Medium access with collisions enabled is a simplified DCF: DIFS plus a random
+ * number of 9 µs slots before every attempt; if the medium is busy when the
+ * backoff expires the device waits for it to clear and draws a new backoff (no
+ * freezing). The contention window doubles with every retry, from CwMin to CwMax.
+ */
+
+#include "unit-disk-net-device.h"
+#include "ns3/ethernet-header.h"
+#include "ns3/log.h"
+#include <algorithm>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("UnitDiskNetDevice");
+NS_OBJECT_ENSURE_REGISTERED(UnitDiskChannel);
+NS_OBJECT_ENSURE_REGISTERED(UnitDiskNetDevice);
+
+namespace {
+const Time SLOT = MicroSeconds(9);
+const Time DIFS = MicroSeconds(34);
+const uint16_t DEFAULT_MTU = 1500;
+}
+
+// ---------------------------------------------------------------------------
+// UnitDiskChannel
+
+TypeId UnitDiskChannel::GetTypeId() {
+    static TypeId tid = TypeId("ns3::UnitDiskChannel")
+        .SetParent<Channel>()
+        .SetGroupName("Network")
+        .AddConstructor<UnitDiskChannel>()
+        .AddAttribute("Range", "Devices within this distance of the sender receive its frames (m)",
+                      DoubleValue(200.0),
+                      MakeDoubleAccessor(&UnitDiskChannel::m_range),
+                      MakeDoubleChecker<double>(0.0))
+        .AddAttribute("Airtime", "Time on the air of every frame",
+                      TimeValue(MicroSeconds(200)),
+                      MakeTimeAccessor(&UnitDiskChannel::m_airtime),
+                      MakeTimeChecker())
+        .AddAttribute("Collisions", "Overlapping receptions are lost; senders use carrier sense and backoff",
+                      BooleanValue(false),
+                      MakeBooleanAccessor(&UnitDiskChannel::m_collisions),
+                      MakeBooleanChecker());
+    return tid;
+}
+
+UnitDiskChannel::UnitDiskChannel()
+    : m_range(200.0),
+      m_airtime(MicroSeconds(200)),
+      m_collisions(false) {
+}
+
+void UnitDiskChannel::DoDispose() {
+    m_devices.clear();
+    Channel::DoDispose();
+}
+
+void UnitDiskChannel::Add(Ptr<UnitDiskNetDevice> device) {
+    m_devices.push_back(device);
+}
+
+Ptr<NetDevice> UnitDiskChannel::GetDevice(std::size_t i) const {
+    return m_devices[i];
+}
+
+void UnitDiskChannel::Transmit(Ptr<UnitDiskNetDevice> sender, Ptr<Packet> frame, Mac48Address destination) {
+    Ptr<UnitDiskTransmission> tx = Create<UnitDiskTransmission>();
+    tx->sender = sender;
+    tx->frame = frame;
+    tx->destination = destination;
+
+    const Vector from = sender->GetMobility()->GetPosition();
+    const double range2 = m_range * m_range;
+    for (const Ptr<UnitDiskNetDevice>& device : m_devices) {
+        if (device == sender) continue;
+        const Vector to = device->GetMobility()->GetPosition();
+        const double dx = to.x - from.x;
+        const double dy = to.y - from.y;
+        const double dz = to.z - from.z;
+        if (dx * dx + dy * dy + dz * dz <= range2) {
+            tx->receivers.push_back(device);
+            tx->corrupted.push_back(false);
+        }
+    }
+
+    if (m_collisions) {
+        const Time end = Simulator::Now() + m_airtime;
+        for (uint32_t i = 0; i < tx->receivers.size(); ++i) {
+            tx->receivers[i]->StartReceive(tx, i, end);
+        }
+    }
+    Simulator::Schedule(m_airtime, &UnitDiskChannel::EndTransmission, this, tx);
+}
+
+void UnitDiskChannel::EndTransmission(Ptr<UnitDiskTransmission> tx) {
+    bool delivered = tx->destination.IsGroup();
+    for (uint32_t i = 0; i < tx->receivers.size(); ++i) {
+        if (tx->corrupted[i]) continue;
+        if (tx->receivers[i]->GetAddress() == tx->destination) {
+            delivered = true;
+        }
+        tx->receivers[i]->Receive(tx->frame->Copy());
+    }
+    tx->sender->TransmitComplete(delivered);
+}
+
+// ---------------------------------------------------------------------------
+// UnitDiskNetDevice
+
+TypeId UnitDiskNetDevice::GetTypeId() {
+    static TypeId tid = TypeId("ns3::UnitDiskNetDevice")
+        .SetParent<NetDevice>()
+        .SetGroupName("Network")
+        .AddConstructor<UnitDiskNetDevice>()
+        .AddAttribute("MaxQueue", "Frames waiting for the medium before drops",
+                      UintegerValue(100),
+                      MakeUintegerAccessor(&UnitDiskNetDevice::m_maxQueue),
+                      MakeUintegerChecker<uint32_t>(1))
+        .AddAttribute("MaxRetries", "Retransmissions of a unicast frame before it is dropped",
+                      UintegerValue(7),
+                      MakeUintegerAccessor(&UnitDiskNetDevice::m_maxRetries),
+                      MakeUintegerChecker<uint32_t>())
+        .AddAttribute("CwMin", "Minimum contention window (slots)",
+                      UintegerValue(15),
+                      MakeUintegerAccessor(&UnitDiskNetDevice::m_cwMin),
+                      MakeUintegerChecker<uint32_t>())
+        .AddAttribute("CwMax", "Maximum contention window (slots)",
+                      UintegerValue(1023),
+                      MakeUintegerAccessor(&UnitDiskNetDevice::m_cwMax),
+                      MakeUintegerChecker<uint32_t>())
+        .AddTraceSource("MacTx", "Frame put on the air (every attempt)",
+                        MakeTraceSourceAccessor(&UnitDiskNetDevice::m_macTxTrace),
+                        "ns3::Packet::TracedCallback")
+        .AddTraceSource("MacTxDrop", "Frame dropped (queue full or retries exhausted)",
+                        MakeTraceSourceAccessor(&UnitDiskNetDevice::m_macTxDropTrace),
+                        "ns3::Packet::TracedCallback")
+        .AddTraceSource("MacRx", "Intact frame received",
+                        MakeTraceSourceAccessor(&UnitDiskNetDevice::m_macRxTrace),
+                        "ns3::Packet::TracedCallback");
+    return tid;
+}
+
+UnitDiskNetDevice::UnitDiskNetDevice()
+    : m_ifIndex(0),
+      m_mtu(DEFAULT_MTU),
+      m_maxQueue(100),
+      m_maxRetries(7),
+      m_cwMin(15),
+      m_cwMax(1023),
+      m_busy(false),
+      m_attempt(0),
+      m_txEnd(Time(0)),
+      m_rxEnd(Time(0)),
+      m_rxBusySince(Time(0)),
+      m_rxIndex(0),
+      m_txFrames(0),
+      m_retries(0),
+      m_collisions(0),
+      m_queueDrops(0),
+      m_retryDrops(0) {
+    m_backoff = CreateObject<UniformRandomVariable>();
+}
+
+void UnitDiskNetDevice::DoDispose() {
+    m_accessEvent.Cancel();
+    m_queue.clear();
+    m_rxCurrent = nullptr;
+    m_node = nullptr;
+    m_channel = nullptr;
+    m_mobility = nullptr;
+    m_rxCallback.Nullify();
+    m_promiscCallback.Nullify();
+    NetDevice::DoDispose();
+}
+
+void UnitDiskNetDevice::SetChannel(Ptr<UnitDiskChannel> channel) {
+    m_channel = channel;
+    m_channel->Add(this);
+    m_linkChanges();
+}
+
+bool UnitDiskNetDevice::SetMtu(const uint16_t mtu) {
+    m_mtu = mtu;
+    return true;
+}
+
+Address UnitDiskNetDevice::GetMulticast(Ipv4Address multicastGroup) const {
+    return Mac48Address::GetMulticast(multicastGroup);
+}
+
+Address UnitDiskNetDevice::GetMulticast(Ipv6Address addr) const {
+    return Mac48Address::GetMulticast(addr);
+}
+
+Ptr<MobilityModel> UnitDiskNetDevice::GetMobility() const {
+    if (!m_mobility) {
+        m_mobility = m_node->GetObject<MobilityModel>();
+        NS_ASSERT_MSG(m_mobility, "UnitDiskNetDevice on node " << m_node->GetId() << " without mobility model");
+    }
+    return m_mobility;
+}
+
+bool UnitDiskNetDevice::Send(Ptr<Packet> packet, const Address& dest, uint16_t protocolNumber) {
+    return SendFrom(packet, m_address, dest, protocolNumber);
+}
+
+bool UnitDiskNetDevice::SendFrom(Ptr<Packet> packet, const Address& source, const Address& dest,
+                                 uint16_t protocolNumber) {
+    if (packet->GetSize() > m_mtu) {
+        NS_LOG_WARN("Packet of " << packet->GetSize() << " bytes exceeds the MTU");
+        return false;
+    }
+    Mac48Address destination = Mac48Address::ConvertFrom(dest);
+    EthernetHeader header(false);
+    header.SetSource(Mac48Address::ConvertFrom(source));
+    header.SetDestination(destination);
+    header.SetLengthType(protocolNumber);
+    packet->AddHeader(header);
+
+    if (m_queue.size() >= m_maxQueue) {
+        m_queueDrops++;
+        m_macTxDropTrace(packet);
+        return false;
+    }
+    m_queue.push_back({packet, destination});
+    if (!m_busy) {
+        m_busy = true;
+        StartAccess();
+    }
+    return true;
+}
+
+Time UnitDiskNetDevice::Backoff() const {
+    uint64_t cw = std::min<uint64_t>(m_cwMax, ((uint64_t(m_cwMin) + 1) << std::min<uint32_t>(m_attempt, 16)) - 1);
+    return DIFS + SLOT * static_cast<int64_t>(m_backoff->GetInteger(0, static_cast<uint32_t>(cw)));
+}
+
+void UnitDiskNetDevice::StartAccess() {
+    // Without collisions the medium is never contended: send as soon as the last frame ends
+    Time delay = m_channel->GetCollisions() ? Backoff() : Time(0);
+    m_accessEvent = Simulator::Schedule(delay, &UnitDiskNetDevice::AccessGranted, this);
+}
+
+void UnitDiskNetDevice::AccessGranted() {
+    const bool collisions = m_channel->GetCollisions();
+    if (collisions && IsCarrierBusy()) {
+        m_accessEvent = Simulator::Schedule(m_rxEnd - Simulator::Now() + Backoff(),
+                                            &UnitDiskNetDevice::AccessGranted, this);
+        return;
+    }
+    if (collisions && IsReceiving()) {
+        Corrupt(m_rxCurrent, m_rxIndex);  // Half duplex: a frame starting in this instant is lost here
+    }
+
+    const QueuedFrame& head = m_queue.front();
+    m_txEnd = Simulator::Now() + m_channel->GetAirtime();
+    m_txFrames++;
+    if (m_attempt > 0) {
+        m_retries++;
+    }
+    m_macTxTrace(head.frame);
+    m_channel->Transmit(this, head.frame, head.destination);
+}
+
+void UnitDiskNetDevice::TransmitComplete(bool delivered) {
+    const QueuedFrame& head = m_queue.front();
+    if (!delivered) {
+        if (m_attempt < m_maxRetries) {
+            m_attempt++;
+            StartAccess();
+            return;
+        }
+        m_retryDrops++;
+        m_macTxDropTrace(head.frame);
+    }
+    m_queue.pop_front();
+    m_attempt = 0;
+    m_busy = !m_queue.empty();
+    if (m_busy) {
+        StartAccess();
+    }
+}
+
+void UnitDiskNetDevice::StartReceive(Ptr<UnitDiskTransmission> tx, uint32_t index, Time end) {
+    if (IsTransmitting()) {
+        Corrupt(tx, index);
+    }
+    if (IsReceiving()) {
+        // Overlap: both the new frame and the one ending last are lost (frames that ended
+        // earlier were corrupted when the later one arrived)
+        Corrupt(tx, index);
+        Corrupt(m_rxCurrent, m_rxIndex);
+    } else {
+        m_rxBusySince = Simulator::Now();
+    }
+    if (end > m_rxEnd) {
+        m_rxEnd = end;
+        m_rxCurrent = tx;
+        m_rxIndex = index;
+    }
+}
+
+void UnitDiskNetDevice::Corrupt(Ptr<UnitDiskTransmission> tx, uint32_t index) {
+    if (!tx->corrupted[index]) {
+        tx->corrupted[index] = true;
+        m_collisions++;
+    }
+}
+
+void UnitDiskNetDevice::Receive(Ptr<Packet> frame) {
+    m_macRxTrace(frame);
+    EthernetHeader header(false);
+    frame->RemoveHeader(header);
+    Mac48Address destination = header.GetDestination();
+    Mac48Address source = header.GetSource();
+    uint16_t protocol = header.GetLengthType();
+
+    NetDevice::PacketType type;
+    if (destination.IsBroadcast()) {
+        type = NetDevice::PACKET_BROADCAST;
+    } else if (destination.IsGroup()) {
+        type = NetDevice::PACKET_MULTICAST;
+    } else if (destination == m_address) {
+        type = NetDevice::PACKET_HOST;
+    } else {
+        type = NetDevice::PACKET_OTHERHOST;
+    }
+
+    if (!m_promiscCallback.IsNull()) {
+        m_promiscCallback(this, frame, protocol, source, destination, type);
+    }
+    if (type != NetDevice::PACKET_OTHERHOST && !m_rxCallback.IsNull()) {
+        m_rxCallback(this, frame, protocol, source);
+    }
+}
+
+int64_t UnitDiskNetDevice::AssignStreams(int64_t stream) {
+    m_backoff->SetStream(stream);
+    return 1;
+}
+
+// ---------------------------------------------------------------------------
+// UnitDiskHelper
+
+UnitDiskHelper::UnitDiskHelper() {
+    m_channelFactory.SetTypeId("ns3::UnitDiskChannel");
+    m_deviceFactory.SetTypeId("ns3::UnitDiskNetDevice");
+}
+
+void UnitDiskHelper::SetChannelAttribute(const std::string& name, const AttributeValue& value) {
+    m_channelFactory.Set(name, value);
+}
+
+void UnitDiskHelper::SetDeviceAttribute(const std::string& name, const AttributeValue& value) {
+    m_deviceFactory.Set(name, value);
+}
+
+NetDeviceContainer UnitDiskHelper::Install(const NodeContainer& nodes) const {
+    Ptr<UnitDiskChannel> channel = m_channelFactory.Create<UnitDiskChannel>();
+    NetDeviceContainer devices;
+    for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+        Ptr<UnitDiskNetDevice> device = m_deviceFactory.Create<UnitDiskNetDevice>();
+        device->SetAddress(Mac48Address::Allocate());
+        nodes.Get(i)->AddDevice(device);
+        device->SetChannel(channel);
+        devices.Add(device);
+    }
+    NS_LOG_INFO("Unit-disk devices on " << nodes.GetN() << " nodes");
+    return devices;
+}
+
+int64_t UnitDiskHelper::AssignStreams(NetDeviceContainer devices, int64_t stream) const {
+    int64_t current = stream;
+    for (uint32_t i = 0; i < devices.GetN(); ++i) {
+        Ptr<UnitDiskNetDevice> device = DynamicCast<UnitDiskNetDevice>(devices.Get(i));
+        if (device) {
+            current += device->AssignStreams(current);
+        }
+    }
+    return current - stream;
+}
+
+UnitDiskHelper::Counters UnitDiskHelper::GetCounters(NetDeviceContainer devices) {
+    Counters counters;
+    for (uint32_t i = 0; i < devices.GetN(); ++i) {
+        Ptr<UnitDiskNetDevice> device = DynamicCast<UnitDiskNetDevice>(devices.Get(i));
+        if (!device) continue;
+        counters.txFrames += device->GetTxFrames();
+        counters.retries += device->GetRetries();
+        counters.collisions += device->GetCollisions();
+        counters.queueDrops += device->GetQueueDrops();
+        counters.retryDrops += device->GetRetryDrops();
+    }
+    return counters;
+}
+
+} // namespace ns3
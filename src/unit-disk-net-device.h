@@ -0,0 +1,261 @@
+/**
+ * Unit-Disk Net Device
+ *
+ * Purpose: Lightweight ground link layer for routing-overhead studies
+ * Features:
+ * - UnitDiskChannel: a frame reaches every device within Range (m) of the sender,
+ *   nothing beyond; no SNR, interference power, preamble detection or rate control
+ * - Fixed airtime per frame (Airtime), independent of size
+ * - Optional collisions (Collisions=true): overlapping receptions at a device are
+ *   all lost, a device cannot receive while transmitting, senders defer while they
+ *   hear a frame and back off a random number of slots (binary exponential)
+ * - Unicast frames that do not reach their destination intact are retried up to
+ *   MaxRetries times (implicit ACK at the end of the frame), then dropped
+ * - Ethernet framing (14-byte header, ARP), so the internet stack and all routing
+ *   protocol wrappers run on it unchanged
+ * - One simulator event per frame and attempt (the Yans PHY schedules several per
+ *   receiver)
+ *
+ * Usage:
+ *   UnitDiskHelper unitDisk;
+ *   unitDisk.SetChannelAttribute("Range", DoubleValue(200.0));
+ *   unitDisk.SetChannelAttribute("Collisions", BooleanValue(true));
+ *   NetDeviceContainer devices = unitDisk.Install(nodes);  // Nodes need mobility
+ *   ... install internet stack / routing, assign addresses ...
+ *   UnitDiskHelper::GetCounters(devices).collisions;
+ */
+
+#ifndef UNIT_DISK_NET_DEVICE_H
+#define UNIT_DISK_NET_DEVICE_H
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-model.h"
+#include <deque>
+#include <vector>
+
+namespace ns3 {
+
+class UnitDiskNetDevice;
+
+/**
+ * A frame in the air: sender, receivers in range and whether each reception was corrupted
+ */
+struct UnitDiskTransmission : public SimpleRefCount<UnitDiskTransmission> {
+    Ptr<UnitDiskNetDevice> sender;
+    Ptr<Packet> frame;
+    Mac48Address destination;
+    std::vector<Ptr<UnitDiskNetDevice>> receivers;
+    std::vector<bool> corrupted;  // Per receiver
+};
+
+class UnitDiskChannel : public Channel {
+public:
+    static TypeId GetTypeId();
+
+    UnitDiskChannel();
+    ~UnitDiskChannel() override = default;
+
+    void Add(Ptr<UnitDiskNetDevice> device);
+
+    std::size_t GetNDevices() const override { return m_devices.size(); }
+    Ptr<NetDevice> GetDevice(std::size_t i) const override;
+
+    /**
+     * Put a frame on the air for one airtime; receivers in range get it at the end,
+     * then the sender learns whether the destination received it intact
+     */
+    void Transmit(Ptr<UnitDiskNetDevice> sender, Ptr<Packet> frame, Mac48Address destination);
+
+    Time GetAirtime() const { return m_airtime; }
+    bool GetCollisions() const { return m_collisions; }
+
+private:
+    void DoDispose() override;
+    void EndTransmission(Ptr<UnitDiskTransmission> tx);
+
+    std::vector<Ptr<UnitDiskNetDevice>> m_devices;
+
+    // Attributes
+    double m_range;
+    Time m_airtime;
+    bool m_collisions;
+};
+
+class UnitDiskNetDevice : public NetDevice {
+public:
+    static TypeId GetTypeId();
+
+    UnitDiskNetDevice();
+    ~UnitDiskNetDevice() override = default;
+
+    void SetChannel(Ptr<UnitDiskChannel> channel);
+
+    // NetDevice
+    void SetIfIndex(const uint32_t index) override { m_ifIndex = index; }
+    uint32_t GetIfIndex() const override { return m_ifIndex; }
+    Ptr<Channel> GetChannel() const override { return m_channel; }
+    void SetAddress(Address address) override { m_address = Mac48Address::ConvertFrom(address); }
+    Address GetAddress() const override { return m_address; }
+    bool SetMtu(const uint16_t mtu) override;
+    uint16_t GetMtu() const override { return m_mtu; }
+    bool IsLinkUp() const override { return static_cast<bool>(m_channel); }
+    void AddLinkChangeCallback(Callback<void> callback) override { m_linkChanges.ConnectWithoutContext(callback); }
+    bool IsBroadcast() const override { return true; }
+    Address GetBroadcast() const override { return Mac48Address::GetBroadcast(); }
+    bool IsMulticast() const override { return true; }
+    Address GetMulticast(Ipv4Address multicastGroup) const override;
+    Address GetMulticast(Ipv6Address addr) const override;
+    bool IsBridge() const override { return false; }
+    bool IsPointToPoint() const override { return false; }
+    bool Send(Ptr<Packet> packet, const Address& dest, uint16_t protocolNumber) override;
+    bool SendFrom(Ptr<Packet> packet, const Address& source, const Address& dest, uint16_t protocolNumber) override;
+    Ptr<Node> GetNode() const override { return m_node; }
+    void SetNode(Ptr<Node> node) override { m_node = node; }
+    bool NeedsArp() const override { return true; }
+    void SetReceiveCallback(NetDevice::ReceiveCallback cb) override { m_rxCallback = cb; }
+    void SetPromiscReceiveCallback(NetDevice::PromiscReceiveCallback cb) override { m_promiscCallback = cb; }
+    bool SupportsSendFrom() const override { return true; }
+
+    /**
+     * Channel side: position (for range checks) and medium state
+     */
+    Ptr<MobilityModel> GetMobility() const;
+    bool IsTransmitting() const { return m_txEnd > Simulator::Now(); }
+    bool IsReceiving() const { return m_rxEnd > Simulator::Now(); }
+
+    /**
+     * Channel side (collision model): a frame starts arriving, ending at end; marks it
+     * and any overlapping reception as corrupted
+     */
+    void StartReceive(Ptr<UnitDiskTransmission> tx, uint32_t index, Time end);
+
+    /**
+     * Channel side: an intact frame has arrived
+     */
+    void Receive(Ptr<Packet> frame);
+
+    /**
+     * Channel side: end of this device's frame (delivered = destination got it intact)
+     */
+    void TransmitComplete(bool delivered);
+
+    /**
+     * Fix the backoff random stream
+     *
+     * @return Number of streams used
+     */
+    int64_t AssignStreams(int64_t stream);
+
+    uint64_t GetTxFrames() const { return m_txFrames; }
+    uint64_t GetRetries() const { return m_retries; }
+    uint64_t GetCollisions() const { return m_collisions; }
+    uint64_t GetQueueDrops() const { return m_queueDrops; }
+    uint64_t GetRetryDrops() const { return m_retryDrops; }
+
+private:
+    struct QueuedFrame {
+        Ptr<Packet> frame;
+        Mac48Address destination;
+    };
+
+    void DoDispose() override;
+
+    /**
+     * Contend for the medium for the frame at the head of the queue
+     */
+    void StartAccess();
+    void AccessGranted();
+    Time Backoff() const;
+
+    /**
+     * Carrier sense: hearing a frame that started before now (frames starting in the
+     * same instant are not yet detectable, so equal backoffs collide)
+     */
+    bool IsCarrierBusy() const { return IsReceiving() && m_rxBusySince < Simulator::Now(); }
+
+    /**
+     * Mark the reception of tx at receiver index as corrupted
+     */
+    void Corrupt(Ptr<UnitDiskTransmission> tx, uint32_t index);
+
+    Ptr<Node> m_node;
+    Ptr<UnitDiskChannel> m_channel;
+    mutable Ptr<MobilityModel> m_mobility;  // Looked up on first use
+    Mac48Address m_address;
+    uint32_t m_ifIndex;
+    uint16_t m_mtu;
+    NetDevice::ReceiveCallback m_rxCallback;
+    NetDevice::PromiscReceiveCallback m_promiscCallback;
+    TracedCallback<> m_linkChanges;
+
+    // Attributes
+    uint32_t m_maxQueue;
+    uint32_t m_maxRetries;
+    uint32_t m_cwMin;
+    uint32_t m_cwMax;
+
+    // MAC state
+    std::deque<QueuedFrame> m_queue;
+    bool m_busy;                    // Head of queue contending or on the air
+    uint32_t m_attempt;             // Retries of the head frame so far
+    EventId m_accessEvent;
+    Time m_txEnd;
+    Time m_rxEnd;
+    Time m_rxBusySince;             // Start of the current busy period
+    Ptr<UnitDiskTransmission> m_rxCurrent;  // Reception ending last (collision marking)
+    uint32_t m_rxIndex;
+    Ptr<UniformRandomVariable> m_backoff;
+
+    // Counters
+    uint64_t m_txFrames;
+    uint64_t m_retries;
+    uint64_t m_collisions;
+    uint64_t m_queueDrops;
+    uint64_t m_retryDrops;
+
+    TracedCallback<Ptr<const Packet>> m_macTxTrace;
+    TracedCallback<Ptr<const Packet>> m_macTxDropTrace;
+    TracedCallback<Ptr<const Packet>> m_macRxTrace;
+};
+
+class UnitDiskHelper {
+public:
+    struct Counters {
+        uint64_t txFrames = 0;
+        uint64_t retries = 0;
+        uint64_t collisions = 0;
+        uint64_t queueDrops = 0;
+        uint64_t retryDrops = 0;
+    };
+
+    UnitDiskHelper();
+
+    void SetChannelAttribute(const std::string& name, const AttributeValue& value);
+    void SetDeviceAttribute(const std::string& name, const AttributeValue& value);
+
+    /**
+     * One device per node, all on a new channel (nodes need a mobility model)
+     */
+    NetDeviceContainer Install(const NodeContainer& nodes) const;
+
+    /**
+     * Fix the backoff streams of devices
+     *
+     * @return Number of streams used
+     */
+    int64_t AssignStreams(NetDeviceContainer devices, int64_t stream) const;
+
+    /**
+     * Counters summed over devices
+     */
+    static Counters GetCounters(NetDeviceContainer devices);
+
+private:
+    ObjectFactory m_channelFactory;
+    ObjectFactory m_deviceFactory;
+};
+
+} // namespace ns3
+
+#endif // UNIT_DISK_NET_DEVICE_H
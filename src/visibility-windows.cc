@@ -0,0 +1,333 @@
+/**
+ * Visibility Windows Implementation
+ *
+ * Satellite position on its circular orbit: r·(cos(n t)·p0 + sin(n t)·q0), with p0 and
+ * q0 the unit positions at t = 0 and t = T/4. For a site zenith g, g·ŝ = A·cos(n t − φ)
+ * with A = |(g·p0, g·q0)|, φ = atan2(g·q0, g·p0); the zenith rotates slowly (ωE ≪ n),
+ * so the culmination of revolution k is the fixed point of n t = φ(t) + 2πk. A pass
+ * exists if the elevation there is above the mask; rise and set lie within a quarter
+ * orbit of the culmination.
+ */
+
+#include "visibility-windows.h"
+#include "satellite-visibility-index.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE("VisibilityWindows");
+
+namespace {
+const double ROOT_TOLERANCE = 1e-3;  // Rise/set precision (s)
+const uint32_t CULMINATION_ITERATIONS = 5;
+const double GRAZING_MARGIN = 0.05;  // Below this sin-elevation deficit a pass cannot reach the mask
+
+double Dot(const Vector& a, const Vector& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+}
+
+VisibilityWindowTable::VisibilityWindowTable(const WalkerDeltaConstellation& constellation, double maskDeg,
+                                             bool earthRotation)
+    : m_constellation(constellation),
+      m_mask(maskDeg * M_PI / 180.0),
+      m_earthRotation(earthRotation),
+      m_start(0.0),
+      m_stop(0.0) {
+}
+
+uint32_t VisibilityWindowTable::AddSite(double latDeg, double lonDeg, double altitude) {
+    Site site;
+    site.lat = latDeg;
+    site.lon = lonDeg;
+    site.alt = altitude;
+    site.position = SatelliteVisibilityIndex::GeodeticToEcef(latDeg, lonDeg, altitude);
+    double lat = latDeg * M_PI / 180.0;
+    double lon = lonDeg * M_PI / 180.0;
+    site.up = Vector(std::cos(lat) * std::cos(lon), std::cos(lat) * std::sin(lon), std::sin(lat));
+    m_sites.push_back(site);
+    m_windows.resize(m_sites.size() * m_constellation.GetNumSatellites());
+    return m_sites.size() - 1;
+}
+
+Vector VisibilityWindowTable::ToInertial(const Vector& v, double t) const {
+    if (!m_earthRotation) return v;
+    double theta = SatelliteVisibilityIndex::EARTH_ROTATION_RATE * t;
+    double c = std::cos(theta);
+    double s = std::sin(theta);
+    return Vector(c * v.x - s * v.y, s * v.x + c * v.y, v.z);
+}
+
+double VisibilityWindowTable::Margin(const Site& site, uint32_t sat, double t) const {
+    Vector s = m_constellation.GetPosition(sat, t);
+    Vector g = ToInertial(site.position, t);
+    Vector up = ToInertial(site.up, t);
+    Vector d(s.x - g.x, s.y - g.y, s.z - g.z);
+    return Dot(d, up) / std::sqrt(Dot(d, d)) - std::sin(m_mask);
+}
+
+double VisibilityWindowTable::GetElevation(uint32_t site, uint32_t sat, double t) const {
+    NS_ASSERT_MSG(site < m_sites.size(), "Unknown site " << site);
+    double sinEl = Margin(m_sites[site], sat, t) + std::sin(m_mask);
+    return std::asin(std::max(-1.0, std::min(1.0, sinEl))) * 180.0 / M_PI;
+}
+
+double VisibilityWindowTable::Bisect(const Site& site, uint32_t sat, double lo, double hi) const {
+    bool loVisible = Margin(site, sat, lo) > 0.0;
+    while (hi - lo > ROOT_TOLERANCE) {
+        double mid = 0.5 * (lo + hi);
+        if ((Margin(site, sat, mid) > 0.0) == loVisible) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return 0.5 * (lo + hi);
+}
+
+double VisibilityWindowTable::PeakTime(const Site& site, uint32_t sat, double lo, double hi) const {
+    // Golden-section search (elevation is unimodal around a culmination)
+    const double ratio = (std::sqrt(5.0) - 1.0) / 2.0;
+    double a = hi - ratio * (hi - lo);
+    double b = lo + ratio * (hi - lo);
+    double fa = Margin(site, sat, a);
+    double fb = Margin(site, sat, b);
+    while (hi - lo > ROOT_TOLERANCE) {
+        if (fa < fb) {
+            lo = a;
+            a = b;
+            fa = fb;
+            b = lo + ratio * (hi - lo);
+            fb = Margin(site, sat, b);
+        } else {
+            hi = b;
+            b = a;
+            fb = fa;
+            a = hi - ratio * (hi - lo);
+            fa = Margin(site, sat, a);
+        }
+    }
+    return 0.5 * (lo + hi);
+}
+
+void VisibilityWindowTable::ComputePair(uint32_t siteId, uint32_t sat, std::vector<VisibilityWindow>& windows) const {
+    const Site& site = m_sites[siteId];
+    const double period = m_constellation.GetPeriod();
+    const double n = 2.0 * M_PI / period;
+    const double r = m_constellation.GetOrbitRadius();
+
+    Vector p0 = m_constellation.GetPosition(sat, 0.0);
+    Vector q0 = m_constellation.GetPosition(sat, period / 4.0);
+    p0 = Vector(p0.x / r, p0.y / r, p0.z / r);
+    q0 = Vector(q0.x / r, q0.y / r, q0.z / r);
+
+    auto phase = [&](double t) {
+        Vector g = ToInertial(site.up, t);
+        return std::atan2(Dot(g, q0), Dot(g, p0));
+    };
+
+    windows.clear();
+    const int64_t kFirst = static_cast<int64_t>(std::floor(n * m_start / (2.0 * M_PI))) - 1;
+    const int64_t kLast = static_cast<int64_t>(std::ceil(n * m_stop / (2.0 * M_PI))) + 1;
+    for (int64_t k = kFirst; k <= kLast; ++k) {
+        // Culmination of revolution k: n t = φ(t) + 2πk (φ unwrapped between iterations)
+        double phi = phase(2.0 * M_PI * k / n);
+        double t = (phi + 2.0 * M_PI * k) / n;
+        for (uint32_t i = 0; i < CULMINATION_ITERATIONS; ++i) {
+            double next = phase(t);
+            next += 2.0 * M_PI * std::round((phi - next) / (2.0 * M_PI));
+            phi = next;
+            t = (phi + 2.0 * M_PI * k) / n;
+        }
+        if (t < m_start - period / 2.0 || t > m_stop + period / 2.0) continue;
+        if (Margin(site, sat, t) <= 0.0) {
+            // The geodetic zenith is not the geocentric one: near-grazing passes peak
+            // slightly off the culmination, so search the elevation maximum there
+            if (Margin(site, sat, t) < -GRAZING_MARGIN) continue;
+            t = PeakTime(site, sat, t - period / 20.0, t + period / 20.0);
+            if (Margin(site, sat, t) <= 0.0) continue;
+        }
+
+        double lo = t - period / 4.0;
+        double hi = t + period / 4.0;
+        double rise = Margin(site, sat, lo) > 0.0 ? lo : Bisect(site, sat, lo, t);
+        double set = Margin(site, sat, hi) > 0.0 ? hi : Bisect(site, sat, t, hi);
+
+        rise = std::max(rise, m_start);
+        set = std::min(set, m_stop);
+        if (set > rise) {
+            windows.push_back({sat, rise, set});
+        }
+    }
+
+    // Neighbouring revolutions can converge to the same culmination: merge overlaps
+    std::sort(windows.begin(), windows.end(),
+              [](const VisibilityWindow& a, const VisibilityWindow& b) { return a.rise < b.rise; });
+    std::vector<VisibilityWindow> merged;
+    for (const VisibilityWindow& w : windows) {
+        if (!merged.empty() && w.rise <= merged.back().set + ROOT_TOLERANCE) {
+            merged.back().set = std::max(merged.back().set, w.set);
+        } else {
+            merged.push_back(w);
+        }
+    }
+    windows.swap(merged);
+}
+
+void VisibilityWindowTable::Compute(double start, double stop) {
+    NS_ASSERT_MSG(stop >= start, "Visibility window range must not be negative");
+    m_start = start;
+    m_stop = stop;
+    const uint32_t numSats = m_constellation.GetNumSatellites();
+    for (uint32_t site = 0; site < m_sites.size(); ++site) {
+        for (uint32_t sat = 0; sat < numSats; ++sat) {
+            ComputePair(site, sat, m_windows[site * numSats + sat]);
+        }
+    }
+    NS_LOG_INFO("Visibility windows: " << GetNumWindows() << " passes for " << m_sites.size()
+        << " sites × " << numSats << " satellites over [" << start << ", " << stop << "] s");
+}
+
+const std::vector<VisibilityWindow>& VisibilityWindowTable::GetWindows(uint32_t site, uint32_t sat) const {
+    NS_ASSERT_MSG(site < m_sites.size() && sat < m_constellation.GetNumSatellites(), "Unknown site or satellite");
+    return m_windows[site * m_constellation.GetNumSatellites() + sat];
+}
+
+std::vector<VisibilityWindow> VisibilityWindowTable::GetSiteWindows(uint32_t site) const {
+    std::vector<VisibilityWindow> all;
+    for (uint32_t sat = 0; sat < m_constellation.GetNumSatellites(); ++sat) {
+        const std::vector<VisibilityWindow>& pair = GetWindows(site, sat);
+        all.insert(all.end(), pair.begin(), pair.end());
+    }
+    std::sort(all.begin(), all.end(), [](const VisibilityWindow& a, const VisibilityWindow& b) {
+        return a.rise < b.rise || (a.rise == b.rise && a.sat < b.sat);
+    });
+    return all;
+}
+
+bool VisibilityWindowTable::IsVisible(uint32_t site, uint32_t sat, double t) const {
+    const std::vector<VisibilityWindow>& windows = GetWindows(site, sat);
+    auto it = std::upper_bound(windows.begin(), windows.end(), t,
+                               [](double time, const VisibilityWindow& w) { return time < w.rise; });
+    return it != windows.begin() && t < std::prev(it)->set;
+}
+
+std::vector<VisibilityWindowTable::Handover> VisibilityWindowTable::GetServingSchedule(uint32_t site) const {
+    std::vector<VisibilityWindow> windows = GetSiteWindows(site);
+    std::vector<Handover> schedule;
+
+    double t = m_start;
+    uint32_t serving = UINT32_MAX;
+    bool first = true;
+    while (t < m_stop) {
+        // Visible now and staying longest; otherwise the next rise
+        const VisibilityWindow* best = nullptr;
+        double nextRise = m_stop;
+        for (const VisibilityWindow& w : windows) {
+            if (w.rise > t) {
+                nextRise = std::min(nextRise, w.rise);
+                break;  // Sorted by rise: nothing later is visible at t
+            }
+            if (t < w.set && (!best || w.set > best->set)) {
+                best = &w;
+            }
+        }
+
+        uint32_t sat = best ? best->sat : UINT32_MAX;
+        if (first || sat != serving) {
+            schedule.push_back({t, sat});
+            serving = sat;
+            first = false;
+        }
+        t = best ? best->set : nextRise;
+    }
+    return schedule;
+}
+
+uint32_t VisibilityWindowTable::GetNumWindows() const {
+    uint32_t count = 0;
+    for (const auto& windows : m_windows) {
+        count += windows.size();
+    }
+    return count;
+}
+
+std::string VisibilityWindowTable::Signature(double start, double stop) const {
+    std::ostringstream oss;
+    oss << std::setprecision(17) << "walker=" << m_constellation.GetNumPlanes() << ":"
+        << m_constellation.GetSatsPerPlane() << ":" << m_constellation.GetPhasing() << ":"
+        << m_constellation.GetOrbitRadius() << ":" << m_constellation.GetInclination()
+        << " mask=" << m_mask << " rotation=" << (m_earthRotation ? 1 : 0)
+        << " range=" << start << ":" << stop << " sites=";
+    for (const Site& site : m_sites) {
+        oss << site.lat << ":" << site.lon << ":" << site.alt << ";";
+    }
+    return oss.str();
+}
+
+bool VisibilityWindowTable::Save(const std::string& path) const {
+    std::string tmpPath = path + ".tmp";
+    std::ofstream out(tmpPath);
+    if (!out.is_open()) {
+        NS_LOG_WARN("Cannot write visibility windows: " << tmpPath);
+        return false;
+    }
+    out << "# " << Signature(m_start, m_stop) << "\n";
+    out << "site,sat,rise,set\n";
+    out << std::setprecision(17);
+    const uint32_t numSats = m_constellation.GetNumSatellites();
+    for (uint32_t site = 0; site < m_sites.size(); ++site) {
+        for (uint32_t sat = 0; sat < numSats; ++sat) {
+            for (const VisibilityWindow& w : m_windows[site * numSats + sat]) {
+                out << site << "," << sat << "," << w.rise << "," << w.set << "\n";
+            }
+        }
+    }
+    out.close();
+    if (!out || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        NS_LOG_WARN("Cannot write visibility windows: " << path);
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool VisibilityWindowTable::Load(const std::string& path, double start, double stop) {
+    std::ifstream in(path);
+    if (!in.is_open()) return false;
+
+    std::string line;
+    if (!std::getline(in, line) || line != "# " + Signature(start, stop)) {
+        NS_LOG_INFO("Visibility window file " << path << " was computed for different parameters");
+        return false;
+    }
+    std::getline(in, line);  // Column header
+
+    const uint32_t numSats = m_constellation.GetNumSatellites();
+    std::vector<std::vector<VisibilityWindow>> windows(m_sites.size() * numSats);
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        uint32_t site;
+        uint32_t sat;
+        double rise;
+        double set;
+        if (std::sscanf(line.c_str(), "%u,%u,%lf,%lf", &site, &sat, &rise, &set) != 4 ||
+            site >= m_sites.size() || sat >= numSats) {
+            NS_LOG_WARN("Malformed visibility window file: " << path);
+            return false;
+        }
+        windows[site * numSats + sat].push_back({sat, rise, set});
+    }
+
+    m_windows.swap(windows);
+    m_start = start;
+    m_stop = stop;
+    return true;
+}
+
+} // namespace ns3
@@ -0,0 +1,160 @@
+/**
+ * Visibility Windows
+ *
+ * Purpose: Precomputed rise/set times of every (ground site, satellite) pair for a run
+ * Features:
+ * - Works from the Walker-Delta orbital elements: on a circular orbit the angle γ
+ *   between the site zenith and the satellite satisfies cos γ = A·cos(n·t − φ), so
+ *   every culmination is solved directly (one per revolution, φ updated for Earth
+ *   rotation) instead of sampling visibility every tick
+ * - Rise and set are then bisected on the exact elevation (geodetic horizon, WGS-84
+ *   site, rotating Earth) to 1 ms
+ * - Windows are sorted interval lists per pair; a serving-satellite schedule
+ *   (longest remaining window) gives exact handover times to schedule as events
+ * - Save/Load as CSV, checked against the constellation, mask and sites, so the
+ *   same table is reused across seeds
+ *
+ * Usage:
+ *   VisibilityWindowTable windows(constellation, 25.0);
+ *   uint32_t gw = windows.AddSite(48.1, 11.6);
+ *   if (!windows.Load(path, 0.0, simTime)) { windows.Compute(0.0, simTime); windows.Save(path); }
+ *   for (const auto& h : windows.GetServingSchedule(gw)) { Simulator::Schedule(Seconds(h.time), ...); }
+ */
+
+#ifndef VISIBILITY_WINDOWS_H
+#define VISIBILITY_WINDOWS_H
+
+#include "walker-delta-constellation.h"
+#include "ns3/vector.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * One pass of a satellite over a site: visible for rise ≤ t < set (s)
+ */
+struct VisibilityWindow {
+    uint32_t sat;
+    double rise;
+    double set;
+};
+
+class VisibilityWindowTable {
+public:
+    /**
+     * Serving-satellite change at time (sat = UINT32_MAX: no satellite visible)
+     */
+    struct Handover {
+        double time;
+        uint32_t sat;
+    };
+
+    /**
+     * @param constellation Orbits (positions as used for satellite placement)
+     * @param maskDeg Minimum elevation (degrees)
+     * @param earthRotation Rotate sites with the Earth (false: sites fixed in the inertial frame)
+     */
+    VisibilityWindowTable(const WalkerDeltaConstellation& constellation, double maskDeg,
+                          bool earthRotation = true);
+
+    /**
+     * Add a ground site (WGS-84 geodetic, Earth-fixed at t = 0 aligned with the inertial frame)
+     *
+     * @return Site ID
+     */
+    uint32_t AddSite(double latDeg, double lonDeg, double altitude = 0.0);
+
+    /**
+     * Solve all windows of all pairs within [start, stop] (windows are clipped)
+     */
+    void Compute(double start, double stop);
+
+    /**
+     * Windows of one pair, sorted by rise
+     */
+    const std::vector<VisibilityWindow>& GetWindows(uint32_t site, uint32_t sat) const;
+
+    /**
+     * All windows of a site, sorted by rise
+     */
+    std::vector<VisibilityWindow> GetSiteWindows(uint32_t site) const;
+
+    bool IsVisible(uint32_t site, uint32_t sat, double t) const;
+
+    /**
+     * Serving satellite over [start, stop]: keep a satellite until it sets, then switch
+     * to the visible satellite that stays longest (first entry at start)
+     */
+    std::vector<Handover> GetServingSchedule(uint32_t site) const;
+
+    /**
+     * Exact elevation of a satellite from a site (degrees)
+     */
+    double GetElevation(uint32_t site, uint32_t sat, double t) const;
+
+    /**
+     * Write the table (CSV; first line identifies constellation, mask, sites and range)
+     */
+    bool Save(const std::string& path) const;
+
+    /**
+     * Read a table saved for the same constellation, mask, Earth rotation, sites and
+     * [start, stop]; returns false (table unchanged) on any mismatch
+     */
+    bool Load(const std::string& path, double start, double stop);
+
+    uint32_t GetNumSites() const { return m_sites.size(); }
+    uint32_t GetNumWindows() const;
+    double GetStart() const { return m_start; }
+    double GetStop() const { return m_stop; }
+
+private:
+    struct Site {
+        double lat;
+        double lon;
+        double alt;
+        Vector position;  // ECEF (m)
+        Vector up;        // Geodetic normal (unit, ECEF)
+    };
+
+    /**
+     * sin(elevation) − sin(mask) (positive while visible)
+     */
+    double Margin(const Site& site, uint32_t sat, double t) const;
+
+    /**
+     * Rotate an ECEF vector into the inertial frame at time t
+     */
+    Vector ToInertial(const Vector& v, double t) const;
+
+    /**
+     * Bisect a sign change of Margin in [lo, hi] (Margin(lo) and Margin(hi) of opposite sign)
+     */
+    double Bisect(const Site& site, uint32_t sat, double lo, double hi) const;
+
+    /**
+     * Time of maximum elevation in [lo, hi]
+     */
+    double PeakTime(const Site& site, uint32_t sat, double lo, double hi) const;
+
+    void ComputePair(uint32_t site, uint32_t sat, std::vector<VisibilityWindow>& windows) const;
+
+    /**
+     * Header line identifying what the table was computed for
+     */
+    std::string Signature(double start, double stop) const;
+
+    const WalkerDeltaConstellation& m_constellation;
+    double m_mask;            // Radians
+    bool m_earthRotation;
+    std::vector<Site> m_sites;
+    std::vector<std::vector<VisibilityWindow>> m_windows;  // [site × numSats + sat]
+    double m_start;
+    double m_stop;
+};
+
+} // namespace ns3
+
+#endif // VISIBILITY_WINDOWS_H
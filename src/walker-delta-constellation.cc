@@ -0,0 +1,81 @@
+/**
+ * Walker-Delta Constellation Geometry Implementation
+ *
+ * Angles are built with the same expressions as the unified-simulation
+ * placement (degrees × π / 180), so t = 0 positions match bit for bit.
+ */
+
+#include "walker-delta-constellation.h"
+#include "ns3/assert.h"
+#include <cmath>
+
+namespace ns3 {
+
+namespace {
+const double EARTH_RADIUS = 6371000.0;        // Mean Earth radius (m)
+const double EARTH_MU = 3.986004418e14;       // Standard gravitational parameter (m³/s²)
+}
+
+WalkerDeltaConstellation::WalkerDeltaConstellation(uint32_t numPlanes,
+                                                   uint32_t satsPerPlane,
+                                                   uint32_t phasing,
+                                                   double altitude,
+                                                   double inclination)
+    : m_numPlanes(numPlanes),
+      m_satsPerPlane(satsPerPlane),
+      m_phasing(phasing),
+      m_radius(EARTH_RADIUS + altitude),
+      m_inclination(inclination * M_PI / 180.0),
+      m_meanMotion(std::sqrt(EARTH_MU / (m_radius * m_radius * m_radius))) {
+    NS_ASSERT_MSG(numPlanes > 0 && satsPerPlane > 0, "Constellation needs at least one satellite");
+    NS_ASSERT_MSG(phasing < numPlanes, "Walker phasing factor must be < number of planes");
+}
+
+double WalkerDeltaConstellation::GetRaan(uint32_t sat) const {
+    uint32_t plane = sat / m_satsPerPlane;
+    return plane * (360.0 / m_numPlanes) * M_PI / 180.0;
+}
+
+double WalkerDeltaConstellation::GetArgumentOfLatitude(uint32_t sat, double t) const {
+    uint32_t plane = sat / m_satsPerPlane;
+    uint32_t idx = sat % m_satsPerPlane;
+    double total = static_cast<double>(m_numPlanes * m_satsPerPlane);
+
+    double u = idx * (360.0 / m_satsPerPlane) * M_PI / 180.0;
+    if (m_phasing > 0) {
+        u += plane * m_phasing * (360.0 / total) * M_PI / 180.0;
+    }
+    if (t != 0.0) {
+        u += m_meanMotion * t;
+    }
+    return u;
+}
+
+Vector WalkerDeltaConstellation::GetPosition(uint32_t sat, double t) const {
+    NS_ASSERT_MSG(sat < GetNumSatellites(), "Satellite " << sat << " out of range");
+
+    double raan = GetRaan(sat);
+    double u = GetArgumentOfLatitude(sat, t);
+
+    double x = m_radius * (std::cos(raan) * std::cos(u) -
+        std::sin(raan) * std::sin(u) * std::cos(m_inclination));
+    double y = m_radius * (std::sin(raan) * std::cos(u) +
+        std::cos(raan) * std::sin(u) * std::cos(m_inclination));
+    double z = m_radius * std::sin(u) * std::sin(m_inclination);
+
+    return Vector(x, y, z);
+}
+
+double WalkerDeltaConstellation::GetLatitude(uint32_t sat, double t) const {
+    return std::asin(std::sin(GetArgumentOfLatitude(sat, t)) * std::sin(m_inclination));
+}
+
+double WalkerDeltaConstellation::GetDistance(uint32_t a, uint32_t b, double t) const {
+    return CalculateDistance(GetPosition(a, t), GetPosition(b, t));
+}
+
+double WalkerDeltaConstellation::GetPeriod() const {
+    return 2.0 * M_PI / m_meanMotion;
+}
+
+} // namespace ns3
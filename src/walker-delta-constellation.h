@@ -0,0 +1,91 @@
+/**
+ * Walker-Delta Constellation Geometry
+ *
+ * Purpose: Satellite positions over time for a Walker-Delta i:T/P/F constellation
+ * Model:
+ * - Circular orbits, two-body mean motion n = sqrt(μ / r³)
+ * - Argument of latitude u = 360°/S × idx + 360°/T × F × plane + n·t
+ * - RAAN Ω = 360°/P × plane
+ * - Inertial frame (TEME-like, no Earth rotation): ISL geometry does not depend on it
+ *
+ * At t = 0 with F = 0 the positions are identical to the unified-simulation
+ * Walker-Delta 53:24/3/1 placement.
+ *
+ * Usage:
+ *   WalkerDeltaConstellation constellation(3, 8, 0, 550000.0, 53.0);
+ *   Vector pos = constellation.GetPosition(sat, 30.0);
+ *   double lat = constellation.GetLatitude(sat, 30.0);
+ */
+
+#ifndef WALKER_DELTA_CONSTELLATION_H
+#define WALKER_DELTA_CONSTELLATION_H
+
+#include "ns3/vector.h"
+#include <cstdint>
+
+namespace ns3 {
+
+class WalkerDeltaConstellation {
+public:
+    /**
+     * @param numPlanes Number of orbital planes (P)
+     * @param satsPerPlane Satellites per plane (S = T / P)
+     * @param phasing Walker phasing factor F (0 ≤ F < P)
+     * @param altitude Orbit altitude above the mean Earth radius (m)
+     * @param inclination Orbit inclination (degrees)
+     */
+    WalkerDeltaConstellation(uint32_t numPlanes,
+                             uint32_t satsPerPlane,
+                             uint32_t phasing,
+                             double altitude,
+                             double inclination);
+
+    /**
+     * Position of a satellite (m, Earth-centred inertial)
+     *
+     * @param sat Satellite ID (plane × satsPerPlane + index)
+     * @param t Time since epoch (s)
+     */
+    Vector GetPosition(uint32_t sat, double t) const;
+
+    /**
+     * Geocentric latitude of a satellite's sub-satellite point (radians)
+     */
+    double GetLatitude(uint32_t sat, double t) const;
+
+    /**
+     * Straight-line distance between two satellites (m)
+     */
+    double GetDistance(uint32_t a, uint32_t b, double t) const;
+
+    uint32_t GetPlane(uint32_t sat) const { return sat / m_satsPerPlane; }
+    uint32_t GetNumSatellites() const { return m_numPlanes * m_satsPerPlane; }
+    uint32_t GetNumPlanes() const { return m_numPlanes; }
+    uint32_t GetSatsPerPlane() const { return m_satsPerPlane; }
+    uint32_t GetPhasing() const { return m_phasing; }
+    double GetOrbitRadius() const { return m_radius; }
+    double GetInclination() const { return m_inclination; } // Radians
+
+    /**
+     * Orbital period (s)
+     */
+    double GetPeriod() const;
+
+private:
+    /**
+     * Argument of latitude u (radians) and RAAN Ω (radians) at time t.
+     */
+    double GetArgumentOfLatitude(uint32_t sat, double t) const;
+    double GetRaan(uint32_t sat) const;
+
+    uint32_t m_numPlanes;
+    uint32_t m_satsPerPlane;
+    uint32_t m_phasing;
+    double m_radius;       // Orbit radius (m)
+    double m_inclination;  // Radians
+    double m_meanMotion;   // Radians per second
+};
+
+} // namespace ns3
+
+#endif // WALKER_DELTA_CONSTELLATION_H